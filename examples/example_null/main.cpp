@@ -1,36 +1,2146 @@
 // dear imgui: null/dummy example application (compile and link imgui with NO INPUTS, NO OUTPUTS)
 // This is useful to test building, but you cannot interact with anything here!
+// It doubles as a headless benchmark: each workload below is run in a fresh context with fixed inputs, and we report
+// per-phase timings (NewFrame, widget submission, EndFrame, Render), vertex/index counts and allocation counts.
+// With --raster, the output of each frame is also rasterized with imgui_impl_software (timed separately), and --screenshot
+// writes the last frame of each workload to a .ppm file (e.g. for screenshot tests on machines without a GPU).
+// Usage: example_null [--frames N] [--warmup N] [--filter substring] [--json] [--list] [--raster] [--threads N] [--screenshot prefix]
 #include "imgui.h"
+#include "imgui_internal.h"
+#include "imgui_impl_software.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
-int main(int, char**)
+//-----------------------------------------------------------------------------
+// Allocation counting
+//-----------------------------------------------------------------------------
+
+// Atomic: memory is also allocated from worker threads (fonts_build_mt, parallel_draw).
+struct BenchAllocStats
 {
-    IMGUI_CHECKVERSION();
+    std::atomic<int>    AllocCount;
+    std::atomic<size_t> AllocBytes;
+};
+static BenchAllocStats GAllocStats;
+
+static void* BenchMemAlloc(size_t sz, void* user_data)
+{
+    BenchAllocStats* stats = (BenchAllocStats*)user_data;
+    stats->AllocCount.fetch_add(1, std::memory_order_relaxed);
+    stats->AllocBytes.fetch_add(sz, std::memory_order_relaxed);
+    return malloc(sz);
+}
+
+static void BenchMemFree(void* ptr, void* user_data)
+{
+    (void)user_data;
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Timing
+//-----------------------------------------------------------------------------
+
+static double BenchGetTimeMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+//-----------------------------------------------------------------------------
+// Counters
+//-----------------------------------------------------------------------------
+// Workloads may report additional named values (e.g. collision counts), appended to the output.
+
+struct BenchCounter
+{
+    const char* Name;
+    double      Value;
+};
+static ImVector<BenchCounter> GCounters;
+
+static void BenchSetCounter(const char* name, double value)
+{
+    for (int n = 0; n < GCounters.Size; n++)
+        if (strcmp(GCounters[n].Name, name) == 0)
+        {
+            GCounters[n].Value = value;
+            return;
+        }
+    BenchCounter counter = { name, value };
+    GCounters.push_back(counter);
+}
+
+//-----------------------------------------------------------------------------
+// Software rasterization
+//-----------------------------------------------------------------------------
+
+static bool             GRasterEnabled = false;
+static int              GThreadsCount = 1;
+static const char*      GScreenshotPrefix = NULL;
+static ImVector<ImU32>  GFramebuffer;
+
+struct BenchParallelForJob
+{
+    int                 Count;
+    std::atomic<int>    Next;
+    void                (*Func)(int index, void* func_arg);
+    void*               FuncArg;
+};
+
+static void BenchParallelForWorker(BenchParallelForJob* job)
+{
+    for (int index = job->Next++; index < job->Count; index = job->Next++)
+        job->Func(index, job->FuncArg);
+}
+
+// Simple ImGui_ImplSoftware_ParallelForFunc: spawn workers for the duration of the call, the calling thread helps.
+static void BenchParallelFor(int count, void (*func)(int index, void* func_arg), void* func_arg, void* user_data)
+{
+    BenchParallelForJob job;
+    job.Count = count;
+    job.Next = 0;
+    job.Func = func;
+    job.FuncArg = func_arg;
+    const int threads_count = *(const int*)user_data - 1;
+    std::thread threads[64];
+    for (int n = 0; n < threads_count && n < IM_ARRAYSIZE(threads); n++)
+        threads[n] = std::thread(BenchParallelForWorker, &job);
+    BenchParallelForWorker(&job);
+    for (int n = 0; n < threads_count && n < IM_ARRAYSIZE(threads); n++)
+        threads[n].join();
+}
+
+static bool BenchWriteScreenshot(const char* filename, const ImU32* pixels, int width, int height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    for (int n = 0; n < width * height; n++)
+    {
+        const unsigned char rgb[3] = { (unsigned char)(pixels[n] >> IM_COL32_R_SHIFT), (unsigned char)(pixels[n] >> IM_COL32_G_SHIFT), (unsigned char)(pixels[n] >> IM_COL32_B_SHIFT) };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Workloads
+//-----------------------------------------------------------------------------
+// - Setup is optional and runs once after CreateContext(), before the font atlas is built (both are timed as 'setup').
+// - Frame is called between NewFrame() and EndFrame(), it must be deterministic.
+// - PreFrame is optional and called before NewFrame() (not timed), when the font atlas can be modified.
+
+struct BenchWorkload
+{
+    const char* Name;
+    void        (*Setup)();
+    void        (*Frame)();
+    void        (*PreFrame)();
+};
+
+static void BenchFrame_DemoWindow()
+{
+    ImGui::ShowDemoWindow(NULL);
+}
+
+static void BenchFrame_TextLines()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("Text Lines");
+    for (int n = 0; n < 10000; n++)
+        ImGui::Text("Line %05d: The quick brown fox jumps over the lazy dog", n);
+    ImGui::End();
+}
+
+// Same contents as text_lines_10k, with io.ConfigTextSizeCache enabled.
+// 'measure_ms' measures 1000 labels at fixed addresses (hashing is skipped), 'measure_buf_ms' the same labels copied in a
+// single buffer (hashed on every lookup). The '_cached_' variants have the cache enabled. Half of the labels are shorter
+// than IMGUI_TEXT_SIZE_CACHE_MIN_LEN and always measured.
+static char GTextSizeCacheLabels[1000][48];
+
+static void BenchSetup_TextSizeCache()
+{
+    ImGui::GetIO().ConfigTextSizeCache = true;
+    for (int n = 0; n < IM_ARRAYSIZE(GTextSizeCacheLabels); n++)
+        ImFormatString(GTextSizeCacheLabels[n], IM_ARRAYSIZE(GTextSizeCacheLabels[n]), (n & 1) ? "Setting %d##setting" : "Longer label for the settings of item number %d", n);
+}
+
+static double BenchMeasureLabels(bool use_cache, bool use_buffer)
+{
+    ImGuiContext& g = *GImGui;
+    const bool backup_use_cache = g.IO.ConfigTextSizeCache;
+    g.IO.ConfigTextSizeCache = use_cache;
+    char buf[48];
+    float total_w = 0.0f;
+    const double t0 = BenchGetTimeMs();
+    for (int n = 0; n < IM_ARRAYSIZE(GTextSizeCacheLabels); n++)
+    {
+        const char* label = GTextSizeCacheLabels[n];
+        if (use_buffer)
+            label = (const char*)memcpy(buf, label, strlen(label) + 1);
+        total_w += ImGui::CalcTextSize(label, NULL, true).x;
+    }
+    const double t1 = BenchGetTimeMs();
+    g.IO.ConfigTextSizeCache = backup_use_cache;
+    IM_ASSERT(total_w > 0.0f);
+    IM_UNUSED(total_w);
+    return t1 - t0;
+}
+
+// Render text with RenderTextClipped() and output the vertices and the indices (relative to the first vertex) it added
+static void BenchRenderTextClipped(const char* text, const ImRect& bb, const ImRect* clip_rect, bool use_cache, ImVector<ImDrawVert>* out_vtx, ImVector<ImDrawIdx>* out_idx)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const int vtx_start = draw_list->VtxBuffer.Size;
+    const int idx_start = draw_list->IdxBuffer.Size;
+    const bool backup_use_cache = g.IO.ConfigTextSizeCache;
+    g.IO.ConfigTextSizeCache = use_cache;
+    ImGui::RenderTextClipped(bb.Min, bb.Max, text, NULL, NULL, ImVec2(0.0f, 0.0f), clip_rect);
+    g.IO.ConfigTextSizeCache = backup_use_cache;
+    out_vtx->resize(0);
+    out_idx->resize(0);
+    for (int n = vtx_start; n < draw_list->VtxBuffer.Size; n++)
+        out_vtx->push_back(draw_list->VtxBuffer[n]);
+    for (int n = idx_start; n < draw_list->IdxBuffer.Size; n++)
+        out_idx->push_back((ImDrawIdx)(draw_list->IdxBuffer[n] - vtx_start));
+}
+
+static void BenchFrame_TextSizeCache()
+{
+    BenchFrame_TextLines();
+
+    // Cached sizes must match sizes measured without the cache
+    ImGuiContext& g = *GImGui;
+    static const char* texts[] = { "Line 00042: The quick brown fox jumps over the lazy dog", "Hello##hidden", "Label long enough to be cached, with a hidden suffix##hidden", "Two\nlines", "Two lines of text, the second one\nbeing longer than the first one", "\xE2\x82\xAC 100", "Prices: \xE2\x82\xAC 100, \xE2\x82\xAC 200, \xE2\x82\xAC 300 and more", "Tab\tand  spaces\r\n\nThird line after an empty line" };
+    for (int n = 0; n < IM_ARRAYSIZE(texts); n++)
+        for (int wrap_n = 0; wrap_n < 2; wrap_n++)
+        {
+            const float wrap_width = wrap_n ? 50.0f : -1.0f;
+            g.IO.ConfigTextSizeCache = false;
+            ImVec2 size_ref = ImGui::CalcTextSize(texts[n], NULL, true, wrap_width);
+            g.IO.ConfigTextSizeCache = true;
+            ImVec2 size_cached = ImGui::CalcTextSize(texts[n], NULL, true, wrap_width);
+            IM_ASSERT(size_ref.x == size_cached.x && size_ref.y == size_cached.y && "CalcTextSize() result differs with io.ConfigTextSizeCache");
+            IM_UNUSED(size_ref);
+            IM_UNUSED(size_cached);
+        }
+
+    // Texts rendered from cached glyphs must output the same vertices, with and without CPU clipping (partially hiding the first line and the first glyphs)
+    ImGui::SetNextWindowPos(ImVec2(820, 0));
+    ImGui::SetNextWindowSize(ImVec2(400, 200));
+    ImGui::Begin("Text Size Cache Check");
+    const int glyphs_hits_start = g.TextSizeCache.GlyphsHits;
+    int glyphs_hits_expected = 0;
+    static ImVector<ImDrawVert> vtx_ref, vtx_cached;
+    static ImVector<ImDrawIdx> idx_ref, idx_cached;
+    const ImVec2 pos = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < IM_ARRAYSIZE(texts); n++)
+        for (int clip_n = 0; clip_n < 2; clip_n++)
+        {
+            if (ImGui::FindRenderedTextEnd(texts[n]) - texts[n] >= IMGUI_TEXT_SIZE_CACHE_MIN_LEN)
+                glyphs_hits_expected += 2;
+            const ImRect bb(pos.x, pos.y, pos.x + 1000.0f, pos.y + 1000.0f);
+            const ImRect clip_rect(pos.x + 12.3f, pos.y + 7.0f, pos.x + 120.0f, pos.y + 40.0f);
+            BenchRenderTextClipped(texts[n], bb, clip_n ? &clip_rect : NULL, false, &vtx_ref, &idx_ref);
+            for (int repeat_n = 0; repeat_n < 2; repeat_n++)
+            {
+                BenchRenderTextClipped(texts[n], bb, clip_n ? &clip_rect : NULL, true, &vtx_cached, &idx_cached);
+                IM_ASSERT(vtx_ref.size_in_bytes() == vtx_cached.size_in_bytes() && memcmp(vtx_ref.Data, vtx_cached.Data, (size_t)vtx_ref.size_in_bytes()) == 0 && "Vertices differ with io.ConfigTextSizeCache");
+                IM_ASSERT(idx_ref.size_in_bytes() == idx_cached.size_in_bytes() && memcmp(idx_ref.Data, idx_cached.Data, (size_t)idx_ref.size_in_bytes()) == 0 && "Indices differ with io.ConfigTextSizeCache");
+            }
+        }
+    IM_ASSERT(g.TextSizeCache.GlyphsHits - glyphs_hits_start == glyphs_hits_expected && "Texts were not rendered from cached glyphs");
+    IM_UNUSED(glyphs_hits_expected);
+    ImGui::End();
+
+    BenchSetCounter("measure_ms", BenchMeasureLabels(false, false));
+    BenchSetCounter("measure_cached_ms", BenchMeasureLabels(true, false));
+    BenchSetCounter("measure_buf_ms", BenchMeasureLabels(false, true));
+    BenchSetCounter("measure_buf_cached_ms", BenchMeasureLabels(true, true));
+
+    const ImGuiTextSizeCache& cache = g.TextSizeCache;
+    BenchSetCounter("hits", cache.HitsLastFrame);
+    BenchSetCounter("misses", cache.MissesLastFrame);
+    BenchSetCounter("glyphs_hits", cache.GlyphsHitsLastFrame);
+    BenchSetCounter("entries", cache.Entries.Size);
+    BenchSetCounter("evicted", cache.EvictedTotal);
+}
+
+// Measuring a large log (~2 MB, mostly ASCII): CalcTextSize() of the whole text without and with word-wrapping, and
+// TextUnformatted(). 'checksum' hashes the results of measuring random strings (ASCII, UTF-8, blanks, punctuation, control
+// characters) with random wrap/max widths: it must be the same in builds with and without IMGUI_DISABLE_SIMD.
+static ImVector<char> GTextLog;
+
+static unsigned int BenchRandom(unsigned int* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static int BenchFormatLogLine(char* line, int line_size, int line_n, unsigned int* rng)
+{
+    static const char* words[] = { "renderer", "frame", "texture", "upload", "ms", "queue", "submitted", "0x1F40", "done.", "error:", "retry,", "(ok)", "caf\xC3\xA9", "\xE2\x82\xAC", "\t" };
+    int len = snprintf(line, line_size, "[%08d] INFO  %s:", line_n, words[BenchRandom(rng) % 4]);
+    for (int word_n = 3 + BenchRandom(rng) % 16; word_n > 0; word_n--)
+        len += snprintf(line + len, line_size - len, " %s", words[BenchRandom(rng) % IM_ARRAYSIZE(words)]);
+    line[len++] = '\n';
+    return len;
+}
+
+static void BenchSetup_TextLog()
+{
+    unsigned int rng = 1;
+    GTextLog.clear();
+    char line[512];
+    for (int line_n = 0; GTextLog.Size < 2 * 1024 * 1024; line_n++)
+    {
+        const int len = BenchFormatLogLine(line, IM_ARRAYSIZE(line), line_n, &rng);
+        for (int n = 0; n < len; n++)
+            GTextLog.push_back(line[n]);
+    }
+    GTextLog.push_back(0);
+}
+
+static ImU32 BenchTextMeasureChecksum(ImFont* font)
+{
+    static const char* pieces[] = { " ", ".", ",", ";", "!", "?", "\"", "\n", "\r", "\t", "\x7F", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\x80" };
+    unsigned int rng = 1;
+    ImU32 checksum = 0;
+    char buf[256];
+    for (int n = 0; n < 2000; n++)
+    {
+        const int len = (int)(BenchRandom(&rng) % IM_ARRAYSIZE(buf));
+        int pos = 0;
+        while (pos < len)
+        {
+            const char* piece = pieces[BenchRandom(&rng) % IM_ARRAYSIZE(pieces)];
+            for (int word_len = (BenchRandom(&rng) % 4) ? (int)(BenchRandom(&rng) % 24) : 0; word_len > 0 && pos < len; word_len--)
+                buf[pos++] = (char)('A' + BenchRandom(&rng) % 58);
+            for (; *piece && pos < len; piece++)
+                buf[pos++] = *piece;
+        }
+        const float wrap_width = (BenchRandom(&rng) % 2) ? (float)(BenchRandom(&rng) % 300) : 0.0f;
+        const float max_width = (BenchRandom(&rng) % 3) ? FLT_MAX : (float)(BenchRandom(&rng) % 500);
+        const char* remaining = NULL;
+        const ImVec2 size = font->CalcTextSizeA(font->FontSize, max_width, wrap_width, buf, buf + len, &remaining);
+        const char* wrap_pos = font->CalcWordWrapPositionA(1.0f, buf, buf + len, wrap_width > 0.0f ? wrap_width : 100.0f);
+        const int offsets[2] = { (int)(remaining - buf), (int)(wrap_pos - buf) };
+        checksum = ImHashData(&size, sizeof(size), checksum);
+        checksum = ImHashData(offsets, sizeof(offsets), checksum);
+    }
+    return checksum;
+}
+
+static void BenchFrame_TextLog()
+{
+    ImFont* font = ImGui::GetFont();
+    const char* text = GTextLog.Data;
+    const char* text_end = GTextLog.Data + GTextLog.Size - 1;
+    double t0 = BenchGetTimeMs();
+    const ImVec2 size = ImGui::CalcTextSize(text, text_end);
+    double t1 = BenchGetTimeMs();
+    const ImVec2 size_wrapped = ImGui::CalcTextSize(text, text_end, false, 800.0f);
+    double t2 = BenchGetTimeMs();
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1000, 1000));
+    ImGui::Begin("Text Log");
+    ImGui::TextUnformatted(text, text_end);
+    ImGui::End();
+    double t3 = BenchGetTimeMs();
+
+    BenchSetCounter("measure_ms", t1 - t0);
+    BenchSetCounter("measure_wrap_ms", t2 - t1);
+    BenchSetCounter("unformatted_ms", t3 - t2);
+    BenchSetCounter("text_w", size.x);
+    BenchSetCounter("text_h", size.y);
+    BenchSetCounter("wrap_h", size_wrapped.y);
+    BenchSetCounter("checksum", BenchTextMeasureChecksum(font));
+}
+
+// Growing log: 32 MB of text displayed with TextUnformatted() and io.ConfigTextLineIndex, scrolled to the middle, with 100 lines
+// appended every frame (ImGuiTextBuffer moves when it grows). The same text is displayed without the index in another window:
+// item size and vertices must be identical. Every 10 frames, the size of the text measured by TextEx() (all lines, not only the
+// visible ones) is also compared. 'scan_ms' is the time taken without the index, 'widths_*_ms' the time taken by TextEx().
+static ImGuiTextBuffer  GTextLogAppend;
+static int              GTextLogAppendLines = 0;
+static unsigned int     GTextLogAppendRng = 1;
+
+static void BenchAppendLogLines(int count)
+{
+    char line[512];
+    for (int n = 0; n < count; n++)
+    {
+        BenchFormatLogLine(line, IM_ARRAYSIZE(line), GTextLogAppendLines++, &GTextLogAppendRng);
+        GTextLogAppend.append(line);
+    }
+}
+
+static void BenchSetup_TextLogIndex()
+{
+    ImGui::GetIO().ConfigTextLineIndex = true;
+    GTextLogAppend.clear();
+    GTextLogAppendLines = 0;
+    GTextLogAppendRng = 1;
+    while (GTextLogAppend.size() < 32 * 1024 * 1024)
+        BenchAppendLogLines(1000);
+}
+
+static ImVec2 BenchTextLogWindow(const char* name, float pos_x, bool line_index, ImGuiTextFlags flags, double* out_ms, ImU32* out_vtx_checksum)
+{
+    ImGui::GetIO().ConfigTextLineIndex = line_index;
+    ImGui::SetNextWindowPos(ImVec2(pos_x, 0));
+    ImGui::SetNextWindowSize(ImVec2(700, 1000));
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_HorizontalScrollbar);
+    ImGui::SetScrollY(ImGui::GetScrollMaxY() * 0.5f);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const int vtx_start = draw_list->VtxBuffer.Size;
+    double t0 = BenchGetTimeMs();
+    ImGui::TextEx(GTextLogAppend.begin(), GTextLogAppend.end(), flags);
+    *out_ms = BenchGetTimeMs() - t0;
+    ImU32 vtx_checksum = 0;
+    for (int n = vtx_start; n < draw_list->VtxBuffer.Size; n++)
+    {
+        ImDrawVert vtx = draw_list->VtxBuffer[n];
+        vtx.pos.x -= pos_x;
+        vtx_checksum = ImHashData(&vtx, sizeof(vtx), vtx_checksum);
+    }
+    *out_vtx_checksum = vtx_checksum;
+    const ImVec2 size = ImGui::GetItemRectSize();
+    ImGui::End();
+    ImGui::GetIO().ConfigTextLineIndex = true;
+    return size;
+}
+
+static void BenchFrame_TextLogIndex()
+{
+    BenchAppendLogLines(100);
+
+    // Same as TextUnformatted()
+    double ms[2];
+    ImU32 vtx_checksum[2];
+    ImVec2 size[2];
+    size[0] = BenchTextLogWindow("Log (indexed)", 0.0f, true, ImGuiTextFlags_NoWidthForLargeClippedText, &ms[0], &vtx_checksum[0]);
+    size[1] = BenchTextLogWindow("Log (scanned)", 700.0f, false, ImGuiTextFlags_NoWidthForLargeClippedText, &ms[1], &vtx_checksum[1]);
+    bool equal = (size[0].x == size[1].x && size[0].y == size[1].y && vtx_checksum[0] == vtx_checksum[1]);
+    IM_ASSERT(equal && "TextUnformatted() output differs with io.ConfigTextLineIndex");
+    BenchSetCounter("indexed_ms", ms[0]);
+    BenchSetCounter("scan_ms", ms[1]);
+
+    // Measuring all lines
+    if (ImGui::GetFrameCount() % 10 == 0)
+    {
+        size[0] = BenchTextLogWindow("Log widths (indexed)", 0.0f, true, ImGuiTextFlags_None, &ms[0], &vtx_checksum[0]);
+        size[1] = BenchTextLogWindow("Log widths (scanned)", 700.0f, false, ImGuiTextFlags_None, &ms[1], &vtx_checksum[1]);
+        equal &= (size[0].x == size[1].x && size[0].y == size[1].y);
+        IM_ASSERT(equal && "TextEx() size differs with io.ConfigTextLineIndex");
+        BenchSetCounter("widths_indexed_ms", ms[0]);
+        BenchSetCounter("widths_scan_ms", ms[1]);
+        BenchSetCounter("text_w", size[0].x);
+    }
+    BenchSetCounter("output_equal", equal ? 1 : 0);
+    BenchSetCounter("lines", GTextLogAppendLines);
+}
+
+// Two ImGuiTextLog holding 500k lines (~40 MB each) in ring buffer mode, with 1000 lines appended every frame. One is displayed
+// without filter (following the last line), the other one with a filter. Every 10 frames, the filtered lines are compared with
+// the result of testing all lines. 'filter_full_ms' is the cost of the first frame, where all lines are tested.
+static ImGuiTextLog*    GTextLogWidgets[2] = { NULL, NULL };
+static ImGuiTextFilter  GTextLogWidgetFilter;
+static int              GTextLogWidgetLines = 0;
+static unsigned int     GTextLogWidgetRng = 1;
+
+static void BenchAppendLogWidgetLines(int count)
+{
+    char line[512];
+    for (int n = 0; n < count; n++)
+    {
+        const int len = BenchFormatLogLine(line, IM_ARRAYSIZE(line), GTextLogWidgetLines++, &GTextLogWidgetRng);
+        GTextLogWidgets[0]->Append(line, line + len);
+        GTextLogWidgets[1]->Append(line, line + len);
+    }
+}
+
+static void BenchSetup_TextLogWidget()
+{
+    for (int n = 0; n < IM_ARRAYSIZE(GTextLogWidgets); n++)
+    {
+        if (GTextLogWidgets[n])
+            IM_DELETE(GTextLogWidgets[n]);
+        GTextLogWidgets[n] = IM_NEW(ImGuiTextLog)(500000);
+    }
+    GTextLogWidgetLines = 0;
+    GTextLogWidgetRng = 1;
+    BenchAppendLogWidgetLines(600000);
+    strcpy(GTextLogWidgetFilter.InputBuf, "upload,-queue");
+    GTextLogWidgetFilter.Build();
+}
+
+static void BenchFrame_TextLogWidget()
+{
+    ImGuiTextLog* log = GTextLogWidgets[1];
+    const bool first_frame = (log->FilteredLineNoEnd == 0);
+    double t0 = BenchGetTimeMs();
+    BenchAppendLogWidgetLines(1000);
+    double t1 = BenchGetTimeMs();
+    IM_ASSERT(log->GetLinesCount() == log->MaxLines);
+    IM_ASSERT(log->LineNoFirst == GTextLogWidgetLines - log->MaxLines);
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(900, 1000));
+    ImGui::Begin("Log Widget");
+    GTextLogWidgets[0]->Draw("log");
+    ImGui::End();
+    double t2 = BenchGetTimeMs();
+
+    ImGui::SetNextWindowPos(ImVec2(900, 0));
+    ImGui::SetNextWindowSize(ImVec2(900, 1000));
+    ImGui::Begin("Log Widget (filtered)");
+    log->Draw("log", ImVec2(0, 0), &GTextLogWidgetFilter);
+    ImGui::End();
+    double t3 = BenchGetTimeMs();
+
+    bool filtered_equal = true;
+    if (ImGui::GetFrameCount() % 10 == 0)
+    {
+        int n = log->FilteredFirst;
+        for (int line_n = 0; line_n < log->GetLinesCount() && filtered_equal; line_n++)
+        {
+            const char* line_end;
+            const char* line = log->GetLine(line_n, &line_end);
+            if (GTextLogWidgetFilter.PassFilter(line, line_end))
+                filtered_equal = (n < log->FilteredLineNos.Size && log->FilteredLineNos[n++] == log->LineNoFirst + line_n);
+        }
+        filtered_equal &= (n == log->FilteredLineNos.Size);
+        IM_ASSERT(filtered_equal && "ImGuiTextLog filtered lines differ from testing all lines");
+    }
+
+    BenchSetCounter("append_ms", t1 - t0);
+    BenchSetCounter("draw_ms", t2 - t1);
+    BenchSetCounter(first_frame ? "filter_full_ms" : "draw_filtered_ms", t3 - t2);
+    BenchSetCounter("lines", log->GetLinesCount());
+    BenchSetCounter("filtered", log->FilteredLineNos.Size - log->FilteredFirst);
+    BenchSetCounter("chunks", log->Chunks.Size);
+    BenchSetCounter("filtered_equal", filtered_equal ? 1 : 0);
+}
+
+static bool BenchListBoxGetter(void*, int idx, const char** out_text)
+{
+    static char buf[32];
+    sprintf(buf, "Item %d", idx);
+    *out_text = buf;
+    return true;
+}
+
+static void BenchFrame_ListBox()
+{
+    static int current_item = 50000;
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("ListBox");
+    ImGui::ListBox("##listbox", &current_item, BenchListBoxGetter, NULL, 100000, 40);
+    ImGui::End();
+}
+
+// 1M items of 1 to 4 lines displayed with ImGuiListClipper and ImGuiListClipperHeights. Every 3 frames we jump to a random
+// scrolling position: the next frame measures the items displayed there (changing the estimated height of the other items),
+// and the frame after must display the same first item at the same position. Measured heights are checked against the text.
+// 'linear_ms' is the time taken to find the first visible item by summing heights, as one would do without the Fenwick tree.
+// Setup compares the tree with sums of random heights.
+static ImGuiListClipperHeights  GListHeights;
+static int                      GListFirstItem = -1;            // First item displayed on the previous frame
+static ImVector<float>          GListItemsPosY[2];              // Positions of the items displayed on the current and previous frames
+static unsigned int             GListRng = 1;
+
+static int BenchListItemLines(int item_n)
+{
+    return 1 + (int)(((unsigned int)item_n * 2654435761u) >> 16) % 4;
+}
+
+static void BenchSetup_ListVariableHeights()
+{
+    unsigned int rng = 1;
+    ImGuiListClipperHeights heights(10.0f);
+    ImVector<float> ref_heights;
+    bool equal = true;
+    for (int round = 0; round < 20 && equal; round++)
+    {
+        const int count = (int)(BenchRandom(&rng) % 20000);
+        heights.Resize(count);
+        ref_heights.resize(count, -1.0f);
+        for (int n = 0; n < 2000 && count > 0; n++)
+        {
+            const int item_n = (int)(BenchRandom(&rng) % count);
+            const float height = (BenchRandom(&rng) % 4) ? (float)(BenchRandom(&rng) % 100) : -1.0f;
+            heights.SetItemHeight(item_n, height);
+            ref_heights[item_n] = height;
+        }
+        double ref_total = 0.0;
+        int ref_measured = 0;
+        for (int n = 0; n < count; n++)
+            if (ref_heights[n] >= 0.0f)
+            {
+                ref_total += ref_heights[n];
+                ref_measured++;
+            }
+        const double estimated_height = ref_measured > 0 ? (float)(ref_total / ref_measured) : 10.0f;
+        double offset = 0.0;
+        for (int n = 0; n <= count && equal; n++)
+        {
+            equal = ImFabs((float)(heights.GetItemOffset(n) - offset)) < 0.01f;
+            if (n < count && (n % 7) == 0)
+            {
+                const float item_height = ref_heights[n] >= 0.0f ? ref_heights[n] : (float)estimated_height;
+                const int found_n = heights.FindItemAtOffset(offset + item_height * 0.5f);
+                equal &= (item_height == 0.0f || found_n == n);
+            }
+            if (n < count)
+                offset += ref_heights[n] >= 0.0f ? ref_heights[n] : estimated_height;
+        }
+        equal &= (heights.FindItemAtOffset(offset + 1.0) == count);
+    }
+    IM_ASSERT(equal && "ImGuiListClipperHeights offsets differ from sums of heights");
+    BenchSetCounter("tree_equal", equal ? 1 : 0);
+
+    GListHeights.Clear();
+    GListFirstItem = -1;
+    GListItemsPosY[0].clear();
+    GListItemsPosY[1].clear();
+    GListRng = 1;
+}
+
+static void BenchFrame_ListVariableHeights()
+{
+    const int items_count = 1000000;
+    const int frame_in_cycle = ImGui::GetFrameCount() % 3;
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("List Variable Heights");
+    const float scroll_max_y = ImGui::GetScrollMaxY();
+
+    static const char details[] = "\n    detail line\n    detail line\n    detail line";
+    const float font_size = ImGui::GetFontSize();
+    const float spacing_y = ImGui::GetStyle().ItemSpacing.y;
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    ImVector<float>& items_pos_y = GListItemsPosY[ImGui::GetFrameCount() & 1];
+    ImVector<float>& prev_items_pos_y = GListItemsPosY[(ImGui::GetFrameCount() + 1) & 1];
+    items_pos_y.resize(0);
+    int first_item = -1;
+    int displayed_count = 0;
+    bool heights_equal = true;
+    double t0 = BenchGetTimeMs();
+    ImGuiListClipper clipper(items_count, &GListHeights);
+    while (clipper.Step())
+        for (int item_n = clipper.DisplayStart; item_n < clipper.DisplayEnd; item_n++)
+        {
+            if (first_item == -1)
+                first_item = item_n;
+            items_pos_y.push_back(window->DC.CursorPos.y);
+            ImGui::Text("Item %07d%.*s", item_n, (BenchListItemLines(item_n) - 1) * 16, details);
+            displayed_count++;
+        }
+    double t1 = BenchGetTimeMs();
+    for (int item_n = first_item; item_n < first_item + displayed_count; item_n++)
+        heights_equal &= (GListHeights.ItemHeights[item_n] == BenchListItemLines(item_n) * font_size + spacing_y);
+
+    // Without the tree: sum heights until the first visible item
+    const float scroll_y = ImGui::GetScrollY();
+    const double est_height = GListHeights.GetEstimatedHeight();
+    double offset = 0.0;
+    int linear_first_item = 0;
+    for (; linear_first_item < items_count; linear_first_item++)
+    {
+        const float h = GListHeights.ItemHeights[linear_first_item];
+        const double item_height = h >= 0.0f ? h : est_height;
+        if (offset + item_height > scroll_y)
+            break;
+        offset += item_height;
+    }
+    double t2 = BenchGetTimeMs();
+
+    // Items must stay in place on the frame following a jump. The first item may be one of the next items of the previous frame,
+    // when it was displayed because its estimated height was larger.
+    bool stable = true;
+    if (frame_in_cycle == 2 && GListFirstItem != -1)
+    {
+        const float tolerance = ImMax(scroll_y * FLT_EPSILON * 2.0f, 0.01f);
+        const int prev_n = first_item - GListFirstItem;
+        stable = (prev_n >= 0 && prev_n < prev_items_pos_y.Size && ImFabs(items_pos_y[0] - prev_items_pos_y[prev_n]) <= tolerance);
+        IM_ASSERT(stable && "ImGuiListClipper with ImGuiListClipperHeights moved the visible items");
+    }
+    IM_ASSERT(heights_equal && "ImGuiListClipper measured wrong item heights");
+    GListFirstItem = first_item;
+    if (frame_in_cycle == 0)
+        ImGui::SetScrollY((float)(int)(scroll_max_y * (BenchRandom(&GListRng) % 900) / 1000.0f));
+    ImGui::End();
+
+    BenchSetCounter("clipper_ms", t1 - t0);
+    BenchSetCounter("linear_ms", t2 - t1);
+    BenchSetCounter("displayed", displayed_count);
+    BenchSetCounter("measured", GListHeights.MeasuredCount);
+    BenchSetCounter("estimated_h", est_height);
+    BenchSetCounter("total_h", GListHeights.GetTotalHeight());
+    BenchSetCounter("stable", stable ? 1 : 0);
+    (void)linear_first_item;
+}
+
+// 100k rows x 500 columns of different widths displayed with ImGuiGridClipper, then with ImGuiListClipper submitting all the
+// columns of visible rows, at the same random scrolling position on both axes: vertices must be identical. Then the same with
+// 100k rows x 40 columns in a Columns() set, against ImGuiListClipper + NextColumn().
+static float                    GGridColumnsWidths[500];
+static unsigned int             GGridRng = 1;
+
+static void BenchSetup_Grid()
+{
+    unsigned int rng = 1;
+    for (int n = 0; n < IM_ARRAYSIZE(GGridColumnsWidths); n++)
+        GGridColumnsWidths[n] = (float)(70 + BenchRandom(&rng) % 60);
+    GGridRng = 1;
+}
+
+static ImU32 BenchGridWindow(const char* name, bool clip_columns, bool columns_set, const ImVec2& scroll, double* out_ms)
+{
+    const int rows_count = 100000;
+    const int columns_count = columns_set ? 40 : IM_ARRAYSIZE(GGridColumnsWidths);
+    const float row_height = ImGui::GetTextLineHeightWithSpacing();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1800, 1000));
+    if (columns_set)
+        ImGui::SetNextWindowContentSize(ImVec2(columns_count * 100.0f, 0.0f));
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_HorizontalScrollbar);
+    ImGui::SetScrollX(scroll.x);
+    ImGui::SetScrollY(scroll.y);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const int vtx_start = draw_list->VtxBuffer.Size;
+
+    double t0 = BenchGetTimeMs();
+    if (columns_set)
+        ImGui::Columns(columns_count, "grid");
+    if (clip_columns)
+    {
+        ImGuiGridClipper clipper(rows_count, columns_count, ImVec2(0.0f, row_height), NULL, columns_set ? NULL : GGridColumnsWidths);
+        while (clipper.Step())
+            for (int row = clipper.DisplayRowStart; row < clipper.DisplayRowEnd; row++)
+                for (int column = clipper.DisplayColumnStart; column < clipper.DisplayColumnEnd; column++)
+                {
+                    clipper.SetCursorToCell(row, column);
+                    ImGui::Text("%d,%d", row, column);
+                }
+    }
+    else
+    {
+        const ImVec2 start_pos = ImGui::GetCursorPos();
+        ImGuiListClipper clipper(rows_count, row_height);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                float offset_x = 0.0f;
+                for (int column = 0; column < columns_count; column++)
+                {
+                    if (!columns_set)
+                        ImGui::SetCursorPos(ImVec2(start_pos.x + offset_x, start_pos.y + row * row_height));
+                    ImGui::Text("%d,%d", row, column);
+                    if (columns_set)
+                        ImGui::NextColumn();
+                    else
+                        offset_x += GGridColumnsWidths[column];
+                }
+            }
+        if (!columns_set)
+            ImGui::SetCursorPosX(start_pos.x);
+    }
+    if (columns_set)
+        ImGui::Columns(1);
+    *out_ms = BenchGetTimeMs() - t0;
+
+    ImU32 vtx_checksum = 0;
+    for (int n = vtx_start; n < draw_list->VtxBuffer.Size; n++)
+        vtx_checksum = ImHashData(&draw_list->VtxBuffer[n], sizeof(ImDrawVert), vtx_checksum);
+    ImGui::End();
+    return vtx_checksum;
+}
+
+static void BenchFrame_Grid()
+{
+    // Scrolling positions within the smallest contents sizes, so both windows of a pair are scrolled the same way
+    // (the width of the contents of the windows submitting all columns includes the text overflowing from the last column).
+    const float rows_height = 100000 * ImGui::GetTextLineHeightWithSpacing();
+    float columns_width = 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(GGridColumnsWidths); n++)
+        columns_width += GGridColumnsWidths[n];
+    const float ratio_x = (BenchRandom(&GGridRng) % 1000) / 1000.0f * 0.9f;
+    const float ratio_y = (BenchRandom(&GGridRng) % 1000) / 1000.0f * 0.9f;
+    const ImVec2 scroll((float)(int)((columns_width - 1800.0f) * ratio_x), (float)(int)((rows_height - 1000.0f) * ratio_y));
+    const ImVec2 scroll_columns_set((float)(int)((40 * 100.0f - 1800.0f) * ratio_x), scroll.y);
+    double ms[4];
+    ImU32 checksum[4];
+    checksum[0] = BenchGridWindow("Grid (clipped)", true, false, scroll, &ms[0]);
+    checksum[1] = BenchGridWindow("Grid (all columns)", false, false, scroll, &ms[1]);
+    checksum[2] = BenchGridWindow("Grid Columns (clipped)", true, true, scroll_columns_set, &ms[2]);
+    checksum[3] = BenchGridWindow("Grid Columns (all columns)", false, true, scroll_columns_set, &ms[3]);
+    const bool equal = (checksum[0] == checksum[1] && checksum[2] == checksum[3]);
+    IM_ASSERT(equal && "ImGuiGridClipper output differs from submitting all columns");
+    BenchSetCounter("grid_ms", ms[0]);
+    BenchSetCounter("all_columns_ms", ms[1]);
+    BenchSetCounter("grid_columns_set_ms", ms[2]);
+    BenchSetCounter("all_columns_set_ms", ms[3]);
+    BenchSetCounter("output_equal", equal ? 1 : 0);
+}
+
+static void BenchSubmitTree(int depth, int max_depth, int fan_out)
+{
+    for (int n = 0; n < fan_out; n++)
+    {
+        ImGui::SetNextItemOpen(true, ImGuiCond_Always);
+        if (ImGui::TreeNode((void*)(intptr_t)n, "Node %d.%d", depth, n))
+        {
+            if (depth + 1 < max_depth)
+                BenchSubmitTree(depth + 1, max_depth, fan_out);
+            else
+                ImGui::Text("Leaf");
+            ImGui::TreePop();
+        }
+    }
+}
+
+static void BenchFrame_TreeNodes()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("Tree Nodes");
+    BenchSubmitTree(0, 6, 4); // 4^6 = 4096 leaves, 5460 nodes
+    ImGui::End();
+}
+
+static void BenchFrame_ManyWindows()
+{
+    for (int n = 0; n < 200; n++)
+    {
+        ImGui::SetNextWindowPos(ImVec2((float)((n % 20) * 90), (float)((n / 20) * 100)));
+        ImGui::SetNextWindowSize(ImVec2(160, 120));
+        char name[32];
+        sprintf(name, "Window %d", n);
+        ImGui::Begin(name);
+        ImGui::Text("Hello from window %d", n);
+        ImGui::Button("Button");
+        ImGui::End();
+    }
+}
+
+// Node editor: 1024 child windows over a canvas larger than its host window, 16 of them moved every frame, under 64 tool windows
+// one of which is focused every frame. The mouse moves randomly. FindHoveredWindow() result is checked against a linear search
+// done before NewFrame(). Compare the new_frame phase of windows_hit_test and windows_hit_test_index (io.ConfigWindowsSpatialIndex).
+static ImVec2                   GHitTestNodesPos[1024];
+static ImVec2                   GHitTestToolsPos[64];
+static unsigned int             GHitTestRng = 1;
+static ImGuiWindow*             GHitTestExpectedWindow = NULL;
+static int                      GHitTestHoveredChildFrames = 0;
+
+static void BenchSetup_WindowsHitTest()
+{
+    unsigned int rng = 1;
+    for (int n = 0; n < IM_ARRAYSIZE(GHitTestNodesPos); n++)
+        GHitTestNodesPos[n] = ImVec2((float)(BenchRandom(&rng) % 4800), (float)(BenchRandom(&rng) % 2800));
+    for (int n = 0; n < IM_ARRAYSIZE(GHitTestToolsPos); n++)
+        GHitTestToolsPos[n] = ImVec2((float)(BenchRandom(&rng) % 1700), (float)(BenchRandom(&rng) % 900));
+    GHitTestRng = 1;
+    GHitTestExpectedWindow = NULL;
+    GHitTestHoveredChildFrames = 0;
+}
+
+static void BenchSetup_WindowsHitTestIndex()
+{
+    BenchSetup_WindowsHitTest();
+    ImGui::GetIO().ConfigWindowsSpatialIndex = true;
+}
+
+static void BenchPreFrame_WindowsHitTest()
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    g.IO.MousePos = ImVec2((float)(BenchRandom(&GHitTestRng) % 1920), (float)(BenchRandom(&GHitTestRng) % 1080));
+
+    // Same as FindHoveredWindow() without the spatial index
+    const ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    const ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(4.0f, 4.0f)) : padding_regular;
+    GHitTestExpectedWindow = NULL;
+    for (int i = g.Windows.Size - 1; i >= 0 && GHitTestExpectedWindow == NULL; i--)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!window->Active || window->Hidden || (window->Flags & ImGuiWindowFlags_NoMouseInputs))
+            continue;
+        ImRect bb(window->OuterRectClipped);
+        bb.Expand((window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize_from_edges);
+        if (bb.Contains(g.IO.MousePos))
+            GHitTestExpectedWindow = window;
+    }
+}
+
+static void BenchFrame_WindowsHitTest()
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    const bool equal = (g.HoveredWindow == GHitTestExpectedWindow);
+    IM_ASSERT(equal && "FindHoveredWindow() result differs from a linear search");
+    if (g.HoveredWindow && (g.HoveredWindow->Flags & ImGuiWindowFlags_ChildWindow))
+        GHitTestHoveredChildFrames++;
+
+    for (int n = 0; n < 16; n++)
+    {
+        ImVec2& pos = GHitTestNodesPos[BenchRandom(&GHitTestRng) % IM_ARRAYSIZE(GHitTestNodesPos)];
+        pos = ImVec2((float)(BenchRandom(&GHitTestRng) % 4800), (float)(BenchRandom(&GHitTestRng) % 2800));
+    }
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("Node Editor", NULL, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoBringToFrontOnFocus);
+    const ImVec2 canvas_pos = ImGui::GetCursorPos();
+    for (int n = 0; n < IM_ARRAYSIZE(GHitTestNodesPos); n++)
+    {
+        ImGui::SetCursorPos(ImVec2(canvas_pos.x + GHitTestNodesPos[n].x, canvas_pos.y + GHitTestNodesPos[n].y));
+        ImGui::PushID(n);
+        ImGui::BeginChild("node", ImVec2(150, 80), true);
+        ImGui::Text("Node %d", n);
+        ImGui::EndChild();
+        ImGui::PopID();
+    }
+    ImGui::End();
+
+    const int focus_n = (int)(BenchRandom(&GHitTestRng) % IM_ARRAYSIZE(GHitTestToolsPos));
+    for (int n = 0; n < IM_ARRAYSIZE(GHitTestToolsPos); n++)
+    {
+        char name[32];
+        sprintf(name, "Tool %d", n);
+        ImGui::SetNextWindowPos(GHitTestToolsPos[n]);
+        ImGui::SetNextWindowSize(ImVec2(200, 150));
+        if (n == focus_n)
+            ImGui::SetNextWindowFocus();
+        ImGui::Begin(name);
+        ImGui::Text("Tool window %d", n);
+        ImGui::End();
+    }
+
+    const ImGuiWindowsSpatialIndex& index = g.WindowsSpatialIndex;
+    BenchSetCounter("windows", g.Windows.Size);
+    BenchSetCounter("hovered_equal", equal ? 1 : 0);
+    BenchSetCounter("hovered_child_frames", GHitTestHoveredChildFrames);
+    if (index.CellsX > 0)
+        BenchSetCounter("mouse_cell_windows", index.Cells[index.GetCellY(g.IO.MousePos.y) * index.CellsX + index.GetCellX(g.IO.MousePos.x)].Size);
+}
+
+// Realistic label corpus: widget labels, "##" suffixed labels, numbered items, file paths.
+static ImVector<char>   GHashCorpus;
+static ImVector<int>    GHashCorpusOffsets;
+
+static int BenchCompareU32(const void* lhs, const void* rhs)
+{
+    ImU32 a = *(const ImU32*)lhs, b = *(const ImU32*)rhs;
+    return (a > b) - (a < b);
+}
+
+static void BenchSetup_HashLabels()
+{
+    static const char* words[] = { "Button", "Checkbox", "Slider", "Value", "Color", "Enabled", "Name", "Position", "Scale", "Rotation", "Texture", "Material" };
+    GHashCorpus.resize(0);
+    GHashCorpusOffsets.resize(0);
+    char buf[128];
+    for (int n = 0; n < 100000; n++)
+    {
+        const char* word = words[n % IM_ARRAYSIZE(words)];
+        switch (n % 5)
+        {
+        case 0: sprintf(buf, "%s %d", word, n); break;
+        case 1: sprintf(buf, "%s##%d", word, n); break;
+        case 2: sprintf(buf, "Item %d", n); break;
+        case 3: sprintf(buf, "src/module_%d/%s_%d.cpp", n / 100, word, n); break;
+        case 4: sprintf(buf, "%s/%s/%d", words[(n / 7) % IM_ARRAYSIZE(words)], word, n); break;
+        }
+        GHashCorpusOffsets.push_back(GHashCorpus.Size);
+        for (const char* p = buf; p == buf || p[-1] != 0; p++)
+            GHashCorpus.push_back(*p);
+    }
+
+    // Collision check: all labels are distinct so any duplicate ID is a collision. Test with two seeds.
+    // For 100k random 32-bit values we expect about n^2/2^33 = ~1.16 collisions per seed.
+    ImVector<ImU32> ids;
+    ids.resize(GHashCorpusOffsets.Size);
+    int collisions = 0;
+    const ImU32 seeds[] = { 0, ImHashStr("Window") };
+    for (int seed_n = 0; seed_n < IM_ARRAYSIZE(seeds); seed_n++)
+    {
+        for (int n = 0; n < GHashCorpusOffsets.Size; n++)
+            ids[n] = ImHashStr(&GHashCorpus[GHashCorpusOffsets[n]], 0, seeds[seed_n]);
+        qsort(ids.Data, (size_t)ids.Size, sizeof(ImU32), BenchCompareU32);
+        for (int n = 1; n < ids.Size; n++)
+            if (ids[n] == ids[n - 1])
+                collisions++;
+    }
+    BenchSetCounter("hash_collisions", collisions);
+
+    // Sanity check for the ### operator
+    IM_ASSERT(ImHashStr("Label###ID") == ImHashStr("Other label###ID"));
+    IM_ASSERT(ImHashStr("Label###ID") != ImHashStr("Label###ID2"));
+}
+
+static void BenchFrame_HashLabels()
+{
+    // Hash with a fixed seed, like widgets sharing the same ID stack
+    const ImU32 seed = ImHashStr("Window");
+    const int labels_count = GHashCorpusOffsets.Size;
+    ImU32 acc = 0;
+    for (int n = 0; n < labels_count; n++)
+        acc ^= ImHashStr(&GHashCorpus[GHashCorpusOffsets[n]], 0, seed);
+    for (int n = 0; n < labels_count; n++)
+        acc ^= ImHashData(&n, sizeof(n), seed);
+    BenchSetCounter("hash_result", acc);
+}
+
+// ImGuiStorage micro-benchmarks (build with EXTRA_CXXFLAGS=-DIMGUI_USE_HASHED_STORAGE to compare)
+static void BenchFrame_StorageInsert()
+{
+    // Insert 10k keys in a fresh storage, in hash order (as tree nodes would be)
+    ImGuiStorage storage;
+    for (int n = 0; n < 10000; n++)
+        storage.SetInt(ImHashData(&n, sizeof(n)), n);
+    int pairs_count = 0; // Live pairs only, Data also holds the unused slots of the hash table with IMGUI_USE_HASHED_STORAGE
+    for (int n = 0; n < storage.Data.Size; n++)
+        if (storage.IsPairUsed(n))
+            pairs_count++;
+    BenchSetCounter("storage_pairs", pairs_count);
+}
+
+static ImGuiStorage GStorageLookup;
+
+static void BenchSetup_StorageLookup()
+{
+    GStorageLookup.Clear();
+    for (int n = 0; n < 50000; n++)
+        GStorageLookup.Data.push_back(ImGuiStorage::Pair(ImHashData(&n, sizeof(n)), n));
+    GStorageLookup.BuildSortByKey();
+}
+
+static void BenchFrame_StorageLookup()
+{
+    // 50k hits followed by 50k misses
+    int acc = 0;
+    for (int n = 0; n < 100000; n++)
+        acc += GStorageLookup.GetInt(ImHashData(&n, sizeof(n)), -1);
+    BenchSetCounter("storage_result", acc);
+}
+
+// Multi-threaded ImDrawList recording: the same chunks of custom drawing are recorded serially into one list, and in parallel
+// into per-chunk lists which are then appended in order. Both outputs must be identical byte for byte.
+static ImVector<ImDrawList*> GDrawChunkLists;
+
+// Draw lists created with IM_NEW() by workloads are kept for the whole run, and deleted before exiting.
+static void BenchDeleteDrawLists(ImVector<ImDrawList*>* lists)
+{
+    for (int n = 0; n < lists->Size; n++)
+        IM_DELETE((*lists)[n]);
+    lists->clear();
+}
+
+static void BenchDrawChunk(ImDrawList* draw_list, int chunk_n)
+{
+    // Some chunks change the clip rectangle or texture, to exercise draw command merging
+    const ImVec2 origin(10.0f + (chunk_n % 4) * 220.0f, 45.0f + (chunk_n / 4) * 200.0f);
+    const ImVec2 size(210.0f, 190.0f);
+    if (chunk_n % 3 == 1)
+        draw_list->PushClipRect(origin, ImVec2(origin.x + size.x, origin.y + size.y), true);
+    const bool push_texture = (chunk_n % 4 == 2);
+    if (push_texture)
+        draw_list->PushTextureID(NULL);
+    for (int n = 0; n < 60; n++)
+    {
+        const float x = origin.x + (n % 10) * 21.0f, y = origin.y + (n / 10) * 30.0f;
+        const ImU32 col = IM_COL32(50 + chunk_n * 12, 255 - n * 3, 100 + n, 255);
+        draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 18.0f, y + 8.0f), col, 2.0f);
+        draw_list->AddLine(ImVec2(x, y + 10.0f), ImVec2(x + 18.0f, y + 14.0f), col, 1.5f);
+        draw_list->AddCircleFilled(ImVec2(x + 9.0f, y + 20.0f), 4.0f, col, 8);
+        if (!push_texture) // AddText() requires the font texture
+            draw_list->AddText(ImVec2(x, y + 22.0f), col, "ab");
+    }
+    if (push_texture)
+        draw_list->PopTextureID();
+    if (chunk_n % 3 == 1)
+        draw_list->PopClipRect();
+}
+
+static void BenchRecordChunk(int chunk_n, void* arg)
+{
+    (void)arg;
+    BenchDrawChunk(GDrawChunkLists[chunk_n], chunk_n);
+}
+
+static bool BenchDrawListsEqual(const ImDrawList* a, const ImDrawList* b)
+{
+    if (a->CmdBuffer.Size != b->CmdBuffer.Size || a->IdxBuffer.Size != b->IdxBuffer.Size || a->VtxBuffer.Size != b->VtxBuffer.Size)
+        return false;
+    for (int n = 0; n < a->CmdBuffer.Size; n++) // Compare fields, ImDrawCmd may have padding
+    {
+        const ImDrawCmd& cmd_a = a->CmdBuffer[n];
+        const ImDrawCmd& cmd_b = b->CmdBuffer[n];
+        if (cmd_a.ElemCount != cmd_b.ElemCount || memcmp(&cmd_a.ClipRect, &cmd_b.ClipRect, sizeof(ImVec4)) != 0 || cmd_a.TextureId != cmd_b.TextureId || cmd_a.UserCallback != cmd_b.UserCallback || cmd_a.UserCallbackData != cmd_b.UserCallbackData)
+            return false;
+    }
+    return memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.size_in_bytes()) == 0
+        && memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0;
+}
+
+static void BenchFrame_ParallelDrawLists()
+{
+    const int chunks_count = 16;
+    while (GDrawChunkLists.Size < chunks_count + 2)
+        GDrawChunkLists.push_back(IM_NEW(ImDrawList)(NULL));
+    ImDrawList* serial_list = GDrawChunkLists[chunks_count];
+    ImDrawList* merged_list = GDrawChunkLists[chunks_count + 1];
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(900, 850));
+    ImGui::Begin("Parallel Draw Lists");
+    ImGui::Text("Custom drawing recorded on %d thread(s)", GThreadsCount);
+    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+
+    // Reference: everything recorded serially
+    double t0 = BenchGetTimeMs();
+    serial_list->ResetForRecording(window_draw_list);
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+        BenchDrawChunk(serial_list, chunk_n);
+
+    // Record chunks in parallel, then append them in order
+    double t1 = BenchGetTimeMs();
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+        GDrawChunkLists[chunk_n]->ResetForRecording(window_draw_list);
+    BenchParallelFor(chunks_count, BenchRecordChunk, NULL, &GThreadsCount);
+    merged_list->ResetForRecording(window_draw_list);
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+        merged_list->AddDrawList(GDrawChunkLists[chunk_n]);
+    double t2 = BenchGetTimeMs();
+
+    const bool equal = BenchDrawListsEqual(serial_list, merged_list);
+    IM_ASSERT(equal && "Parallel recording output differs from serial recording");
+    BenchSetCounter("lists_equal", equal ? 1 : 0);
+    BenchSetCounter("chunk_vtx", merged_list->VtxBuffer.Size);
+    BenchSetCounter("serial_ms", t1 - t0);
+    BenchSetCounter("parallel_ms", t2 - t1);
+
+    // Splice into the window output
+    window_draw_list->AddDrawList(merged_list);
+    ImGui::End();
+}
+
+// Batch primitives: the same scatter plot / heatmap data is submitted with one call per element, and with the batch functions.
+// Both outputs must be identical byte for byte.
+struct BenchHeatmapCell
+{
+    ImVec2  Min, Max;
+    ImU32   Col;
+};
+static ImVector<BenchHeatmapCell>   GBatchCells;
+static ImVector<ImVec2>             GBatchLineP1, GBatchLineP2, GBatchPoints;
+static ImVector<ImU32>              GBatchLineCols;
+static ImVector<ImDrawList*>        GBatchLists;
+
+static void BenchSetup_BatchPrimitives()
+{
+    GBatchCells.resize(120 * 100);
+    for (int n = 0; n < GBatchCells.Size; n++)
+    {
+        const float x = 10.0f + (n % 120) * 7.0f, y = 40.0f + (n / 120) * 7.0f;
+        const int v = (n * 37) & 255;
+        BenchHeatmapCell& cell = GBatchCells[n];
+        cell.Min = ImVec2(x, y);
+        cell.Max = ImVec2(x + 6.0f, y + 6.0f);
+        cell.Col = (n % 97 == 0) ? 0 : IM_COL32(v, 255 - v, 128, 255); // A few transparent cells are skipped
+    }
+    GBatchLineP1.resize(8000);
+    GBatchLineP2.resize(8000);
+    GBatchLineCols.resize(8000);
+    GBatchPoints.resize(2500);
+    for (int n = 0; n < GBatchLineP1.Size; n++)
+    {
+        GBatchLineP1[n] = ImVec2(900.0f + (n % 100) * 9.0f, 40.0f + (n / 100) * 9.0f);
+        GBatchLineP2[n] = ImVec2(GBatchLineP1[n].x + (float)(n % 7), GBatchLineP1[n].y + (float)(n % 5) + 1.0f);
+        GBatchLineCols[n] = IM_COL32(255, n & 255, 0, 200);
+    }
+    for (int n = 0; n < GBatchPoints.Size; n++)
+        GBatchPoints[n] = ImVec2(20.0f + (float)((n * 131) % 1800), 800.0f + (float)((n * 71) % 260));
+}
+
+static void BenchFrame_BatchPrimitives()
+{
+    while (GBatchLists.Size < 6)
+        GBatchLists.push_back(IM_NEW(ImDrawList)(NULL));
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1910, 1070));
+    ImGui::Begin("Batch Primitives");
+    ImGui::Text("%d cells, %d lines, %d points", GBatchCells.Size, GBatchLineP1.Size, GBatchPoints.Size);
+    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+    for (int n = 0; n < GBatchLists.Size; n++)
+        GBatchLists[n]->ResetForRecording(window_draw_list);
+    const float point_radius = 3.0f;
+    const ImU32 point_col = IM_COL32(255, 255, 255, 160);
+
+    // One list per primitive type and per method, to stay within 64K vertices with 16-bit indices
+    double t0 = BenchGetTimeMs();
+    for (int n = 0; n < GBatchCells.Size; n++)
+        GBatchLists[0]->AddRectFilled(GBatchCells[n].Min, GBatchCells[n].Max, GBatchCells[n].Col);
+    double t1 = BenchGetTimeMs();
+    GBatchLists[1]->AddRectFilledBatch(&GBatchCells[0].Min, &GBatchCells[0].Max, &GBatchCells[0].Col, GBatchCells.Size, sizeof(BenchHeatmapCell), sizeof(BenchHeatmapCell));
+    double t2 = BenchGetTimeMs();
+    for (int n = 0; n < GBatchLineP1.Size; n++)
+        GBatchLists[2]->AddLine(GBatchLineP1[n], GBatchLineP2[n], GBatchLineCols[n]);
+    double t3 = BenchGetTimeMs();
+    GBatchLists[3]->AddLineBatch(GBatchLineP1.Data, GBatchLineP2.Data, GBatchLineCols.Data, GBatchLineP1.Size);
+    double t4 = BenchGetTimeMs();
+    for (int n = 0; n < GBatchPoints.Size; n++)
+        GBatchLists[4]->AddCircleFilled(GBatchPoints[n], point_radius, point_col, 8);
+    double t5 = BenchGetTimeMs();
+    GBatchLists[5]->AddCircleFilledBatch(GBatchPoints.Data, &point_radius, &point_col, GBatchPoints.Size, 8, sizeof(ImVec2), 0, 0);
+    double t6 = BenchGetTimeMs();
+
+    const bool equal = BenchDrawListsEqual(GBatchLists[0], GBatchLists[1]) && BenchDrawListsEqual(GBatchLists[2], GBatchLists[3]) && BenchDrawListsEqual(GBatchLists[4], GBatchLists[5]);
+    IM_ASSERT(equal && "Batch primitives output differs from single primitives");
+    BenchSetCounter("lists_equal", equal ? 1 : 0);
+    BenchSetCounter("rects_percall_ms", t1 - t0);
+    BenchSetCounter("rects_batch_ms", t2 - t1);
+    BenchSetCounter("lines_percall_ms", t3 - t2);
+    BenchSetCounter("lines_batch_ms", t4 - t3);
+    BenchSetCounter("circles_percall_ms", t5 - t4);
+    BenchSetCounter("circles_batch_ms", t6 - t5);
+
+    // Only the heatmap is spliced into the window output (the whole set exceeds 64K vertices)
+    window_draw_list->AddDrawList(GBatchLists[1]);
+    ImGui::End();
+}
+
+// Long anti-aliased polylines (e.g. PlotLines() with many samples, waveform views). The 100k samples are submitted in chunks
+// to stay within 64K vertices per list with 16-bit indices. 'vtx_checksum' can be compared between builds (e.g. with and
+// without IMGUI_DISABLE_SIMD) to verify the geometry.
+static ImVector<ImVec2>             GPolylinePoints;
+static ImVector<ImDrawList*>        GPolylineLists;
+
+static void BenchSetup_Polyline()
+{
+    GPolylinePoints.resize(100000);
+    for (int n = 0; n < GPolylinePoints.Size; n++)
+        GPolylinePoints[n] = ImVec2(10.0f + n * 0.019f, 540.0f + 300.0f * ImSin(n * 0.0021f) * ImCos(n * 0.00037f) + ((n % 61) == 0 ? 40.0f : 0.0f));
+}
+
+static void BenchFrame_Polyline()
+{
+    const int chunk_size = 10000;
+    const int chunks_count = GPolylinePoints.Size / chunk_size;
+    while (GPolylineLists.Size < chunks_count)
+        GPolylineLists.push_back(IM_NEW(ImDrawList)(NULL));
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1910, 1070));
+    ImGui::Begin("Polyline");
+    ImGui::Text("%d points", GPolylinePoints.Size);
+    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+
+    double vtx_checksum = 0.0;
+    double t0 = BenchGetTimeMs();
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+    {
+        GPolylineLists[chunk_n]->ResetForRecording(window_draw_list);
+        GPolylineLists[chunk_n]->AddPolyline(&GPolylinePoints[chunk_n * chunk_size], chunk_size + (chunk_n + 1 < chunks_count ? 1 : 0), IM_COL32(255, 200, 0, 255), false, 1.0f);
+    }
+    double t1 = BenchGetTimeMs();
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+        for (int vtx_n = 0; vtx_n < GPolylineLists[chunk_n]->VtxBuffer.Size; vtx_n++)
+            vtx_checksum += GPolylineLists[chunk_n]->VtxBuffer[vtx_n].pos.x + GPolylineLists[chunk_n]->VtxBuffer[vtx_n].pos.y;
+    double t2 = BenchGetTimeMs();
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+    {
+        GPolylineLists[chunk_n]->ResetForRecording(window_draw_list);
+        GPolylineLists[chunk_n]->AddPolyline(&GPolylinePoints[chunk_n * chunk_size], chunk_size + (chunk_n + 1 < chunks_count ? 1 : 0), IM_COL32(0, 200, 255, 255), false, 3.0f);
+    }
+    double t3 = BenchGetTimeMs();
+    for (int chunk_n = 0; chunk_n < chunks_count; chunk_n++)
+        for (int vtx_n = 0; vtx_n < GPolylineLists[chunk_n]->VtxBuffer.Size; vtx_n++)
+            vtx_checksum += GPolylineLists[chunk_n]->VtxBuffer[vtx_n].pos.x + GPolylineLists[chunk_n]->VtxBuffer[vtx_n].pos.y;
+
+    BenchSetCounter("thin_ms", t1 - t0);
+    BenchSetCounter("thick_ms", t3 - t2);
+    BenchSetCounter("vtx_checksum", vtx_checksum);
+
+    // Only the first chunk is spliced into the window output
+    window_draw_list->AddDrawList(GPolylineLists[0]);
+    ImGui::End();
+}
+
+// Circles with an automatic number of segments (from style.CircleSegmentMaxError) versus the former default of 12 segments.
+static void BenchFrame_Circles()
+{
+    static ImDrawList* fixed_list = NULL;
+    if (fixed_list == NULL)
+        fixed_list = IM_NEW(ImDrawList)(NULL);
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1910, 1070));
+    ImGui::Begin("Circles");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    fixed_list->ResetForRecording(draw_list);
+    const int vtx_start = draw_list->VtxBuffer.Size;
+
+    double t0 = BenchGetTimeMs();
+    for (int n = 0; n < 300; n++)
+    {
+        const float radius = 1.0f + (float)((n * 7) % 120);
+        const ImVec2 centre(20.0f + (float)((n * 131) % 1860), 40.0f + (float)((n * 71) % 1000));
+        draw_list->AddCircleFilled(centre, radius, IM_COL32(n & 255, 128, 255 - (n & 255), 40));
+        draw_list->AddCircle(centre, radius, IM_COL32(255, 255, 255, 80));
+    }
+    double t1 = BenchGetTimeMs();
+    for (int n = 0; n < 300; n++)
+    {
+        const float radius = 1.0f + (float)((n * 7) % 120);
+        const ImVec2 centre(20.0f + (float)((n * 131) % 1860), 40.0f + (float)((n * 71) % 1000));
+        fixed_list->AddCircleFilled(centre, radius, IM_COL32(n & 255, 128, 255 - (n & 255), 40), 12);
+        fixed_list->AddCircle(centre, radius, IM_COL32(255, 255, 255, 80), 12);
+    }
+    double t2 = BenchGetTimeMs();
+
+    BenchSetCounter("auto_vtx", draw_list->VtxBuffer.Size - vtx_start);
+    BenchSetCounter("fixed12_vtx", fixed_list->VtxBuffer.Size);
+    BenchSetCounter("auto_ms", t1 - t0);
+    BenchSetCounter("fixed12_ms", t2 - t1);
+    ImGui::End();
+}
+
+// Large glyph ranges: every glyph of DroidSans + Roboto (merged) at 4 sizes, either baked by Build() or rasterized on demand
+// (ImFontAtlasFlags_DynamicGlyphs). Compare 'setup' (atlas build) between both. Frames draw a sliding window over the
+// non-ASCII glyphs of each font, so the dynamic atlas keeps rasterizing new glyphs.
+static ImVector<ImWchar> GFontCodepoints;
+
+static bool BenchAddFontsFullRanges(ImFontAtlas* atlas)
+{
+    static const ImWchar ranges[] = { 0x0020, 0xFFFF, 0 };
+    static const char* filenames[2] = { "../../misc/fonts/DroidSans.ttf", "../../misc/fonts/Roboto-Medium.ttf" };
+    static void* file_data[2] = { NULL, NULL };
+    static size_t file_size[2] = { 0, 0 };
+    for (int n = 0; n < 2; n++)
+        if (file_data[n] == NULL && (file_data[n] = ImFileLoadToMemory(filenames[n], "rb", &file_size[n])) == NULL)
+        {
+            fprintf(stderr, "Could not load '%s', using default font.\n", filenames[n]);
+            return false;
+        }
+    for (float size = 13.0f; size <= 28.0f; size += 5.0f)
+        for (int n = 0; n < 2; n++)
+        {
+            ImFontConfig font_cfg;
+            font_cfg.FontDataOwnedByAtlas = false;
+            font_cfg.MergeMode = (n > 0);
+            atlas->AddFontFromMemoryTTF(file_data[n], (int)file_size[n], size, &font_cfg, ranges);
+        }
+    return true;
+}
+
+static void BenchSetup_FontsFullRanges(bool dynamic_glyphs)
+{
+    GFontCodepoints.clear();
+    ImGuiIO& io = ImGui::GetIO();
+    if (dynamic_glyphs)
+        io.Fonts->Flags |= ImFontAtlasFlags_DynamicGlyphs;
+    BenchAddFontsFullRanges(io.Fonts);
+}
+
+static void BenchSetup_FontsBaked()     { BenchSetup_FontsFullRanges(false); }
+static void BenchSetup_FontsDynamic()   { BenchSetup_FontsFullRanges(true); }
+
+static void BenchGatherFontCodepoints(const ImFont* font)
+{
+    if (!GFontCodepoints.empty())
+        return;
+    for (int c = 0x80; c <= 0xFFFF; c++)
+    {
+        const int index_offset = font->GetIndexOffset((unsigned int)c);
+        if (index_offset >= 0 && font->IndexLookup[index_offset] != (ImWchar)-1)
+            GFontCodepoints.push_back((ImWchar)c);
+    }
+    if (GFontCodepoints.empty())
+        GFontCodepoints.push_back((ImWchar)'?');
+}
+
+static void BenchFrame_FontsFullRanges()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    BenchGatherFontCodepoints(atlas->Fonts[0]);
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1400, 1000));
+    ImGui::Begin("Fonts");
+    const int frame = ImGui::GetFrameCount();
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImGui::PushFont(atlas->Fonts[font_n]);
+        for (int line = 0; line < 4; line++)
+        {
+            ImWchar line_wchars[48 + 1];
+            for (int n = 0; n < 48; n++)
+                line_wchars[n] = GFontCodepoints[(frame * 16 + line * 48 + n) % GFontCodepoints.Size];
+            line_wchars[48] = 0;
+            char line_utf8[48 * 3 + 1];
+            ImTextStrToUtf8(line_utf8, IM_ARRAYSIZE(line_utf8), line_wchars, NULL);
+            ImGui::TextUnformatted(line_utf8);
+        }
+        ImGui::PopFont();
+    }
+    ImGui::End();
+
+    BenchSetCounter("tex_w", atlas->TexWidth);
+    BenchSetCounter("tex_h", atlas->TexHeight);
+    BenchSetCounter("glyphs", atlas->Fonts[0]->Glyphs.Size);
+    ImFontAtlasDynamicStats stats;
+    if (ImFontAtlasGetDynamicStats(atlas, &stats))
+    {
+        BenchSetCounter("resident", stats.GlyphsResident);
+        BenchSetCounter("rasterized", stats.GlyphsRasterized);
+        BenchSetCounter("evicted", stats.GlyphsEvicted);
+        BenchSetCounter("compactions", stats.Compactions);
+        BenchSetCounter("dropped", stats.GlyphsDropped);
+    }
+}
+
+// Multi-threaded atlas build: the same fonts as 'fonts_baked' are built into two atlases, on the calling thread then with
+// ImFontAtlas::BuildParallelFor (use --threads N). Both textures and glyphs must be identical. Timings are reported as counters.
+static bool BenchFontAtlasesEqual(const ImFontAtlas* a, const ImFontAtlas* b)
+{
+    if (a->TexWidth != b->TexWidth || a->TexHeight != b->TexHeight || a->Fonts.Size != b->Fonts.Size)
+        return false;
+    if (memcmp(a->TexPixelsAlpha8, b->TexPixelsAlpha8, (size_t)(a->TexWidth * a->TexHeight)) != 0)
+        return false;
+    for (int n = 0; n < a->Fonts.Size; n++)
+    {
+        const ImFont* font_a = a->Fonts[n];
+        const ImFont* font_b = b->Fonts[n];
+        if (font_a->Glyphs.Size != font_b->Glyphs.Size || memcmp(font_a->Glyphs.Data, font_b->Glyphs.Data, (size_t)font_a->Glyphs.size_in_bytes()) != 0)
+            return false;
+        if (font_a->IndexPages.Size != font_b->IndexPages.Size || memcmp(font_a->IndexPages.Data, font_b->IndexPages.Data, (size_t)font_a->IndexPages.size_in_bytes()) != 0)
+            return false;
+        if (font_a->IndexLookup.Size != font_b->IndexLookup.Size || memcmp(font_a->IndexLookup.Data, font_b->IndexLookup.Data, (size_t)font_a->IndexLookup.size_in_bytes()) != 0)
+            return false;
+        if (font_a->IndexAdvanceX.Size != font_b->IndexAdvanceX.Size || memcmp(font_a->IndexAdvanceX.Data, font_b->IndexAdvanceX.Data, (size_t)font_a->IndexAdvanceX.size_in_bytes()) != 0)
+            return false;
+        if (font_a->FontSize != font_b->FontSize || font_a->Ascent != font_b->Ascent || font_a->Descent != font_b->Descent || font_a->FallbackAdvanceX != font_b->FallbackAdvanceX)
+            return false;
+    }
+    return true;
+}
+
+static void BenchSetup_FontsBuildParallel()
+{
+    ImFontAtlas* atlases[2];
+    double build_ms[2];
+    for (int n = 0; n < 2; n++)
+    {
+        atlases[n] = IM_NEW(ImFontAtlas)();
+        if (n == 1)
+        {
+            atlases[n]->BuildParallelFor = BenchParallelFor;
+            atlases[n]->BuildParallelForUserData = &GThreadsCount;
+        }
+        if (!BenchAddFontsFullRanges(atlases[n]))
+            atlases[n]->AddFontDefault();
+        double t0 = BenchGetTimeMs();
+        atlases[n]->Build();
+        build_ms[n] = BenchGetTimeMs() - t0;
+    }
+
+    const bool equal = BenchFontAtlasesEqual(atlases[0], atlases[1]);
+    IM_ASSERT(equal && "Parallel atlas build differs from serial build");
+    BenchSetCounter("atlas_equal", equal ? 1 : 0);
+    BenchSetCounter("tex_h", atlases[1]->TexHeight);
+    BenchSetCounter("serial_ms", build_ms[0]);
+    BenchSetCounter("parallel_ms", build_ms[1]);
+    for (int n = 0; n < 2; n++)
+        IM_DELETE(atlases[n]);
+}
+
+// Glyph index: CalcTextSizeA() over ASCII and non-ASCII text (with and without wrapping) using the fonts_baked fonts,
+// and the memory used by the glyph index of all fonts.
+static size_t BenchFontIndexBytes(const ImFont* font)
+{
+    return (size_t)font->IndexAdvanceX.Capacity * sizeof(float) + (size_t)font->IndexLookup.Capacity * sizeof(ImWchar) + (size_t)font->IndexPages.Capacity * sizeof(ImU16);
+}
+
+static void BenchFrame_FontIndex()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    BenchGatherFontCodepoints(atlas->Fonts[0]);
+    static const char* ascii_text = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs! 0123456789 (){}[]<>";
+    char unicode_text[128 * 3 + 1];
+    ImWchar unicode_wchars[128 + 1];
+    for (int n = 0; n < 128; n++)
+        unicode_wchars[n] = (n % 8 == 7) ? (ImWchar)' ' : GFontCodepoints[(n * 7) % GFontCodepoints.Size];
+    unicode_wchars[128] = 0;
+    ImTextStrToUtf8(unicode_text, IM_ARRAYSIZE(unicode_text), unicode_wchars, NULL);
+
+    const int iterations = 200;
+    const char* texts[2] = { ascii_text, unicode_text };
+    const char* counter_names[2][2] = { { "ascii_ms", "ascii_wrap_ms" }, { "unicode_ms", "unicode_wrap_ms" } };
+    float total_width = 0.0f;
+    for (int text_n = 0; text_n < 2; text_n++)
+        for (int wrap_n = 0; wrap_n < 2; wrap_n++)
+        {
+            const float wrap_width = wrap_n ? 200.0f : 0.0f;
+            double best_ms = 1e30;
+            for (int pass = 0; pass < 5; pass++)
+            {
+                double t0 = BenchGetTimeMs();
+                for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+                {
+                    const ImFont* font = atlas->Fonts[font_n];
+                    for (int n = 0; n < iterations; n++)
+                        total_width += font->CalcTextSizeA(font->FontSize, FLT_MAX, wrap_width, texts[text_n]).x;
+                }
+                best_ms = ImMin(best_ms, BenchGetTimeMs() - t0);
+            }
+            BenchSetCounter(counter_names[text_n][wrap_n], best_ms);
+        }
+
+    size_t index_bytes = 0;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        index_bytes += BenchFontIndexBytes(atlas->Fonts[font_n]);
+    BenchSetCounter("index_kb", (double)index_bytes / 1024);
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::Begin("Font Index");
+    ImGui::Text("Total width: %.1f", total_width);
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        ImGui::Text("Font %d: glyph index %d bytes", font_n, (int)BenchFontIndexBytes(atlas->Fonts[font_n]));
+    ImGui::End();
+}
+
+// Font atlas cache: the first launch builds the fonts_baked fonts and saves the result, the workload's atlas is then loaded from
+// the saved data: compare load_ms with build_ms. Changing any build input must invalidate the saved data.
+static ImVector<unsigned char> GFontAtlasCache;
+
+static bool BenchFontAtlasCacheIsRejected(int change_n)
+{
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    BenchAddFontsFullRanges(atlas);
+    switch (change_n)
+    {
+    case 0: ((unsigned char*)atlas->ConfigData[1].FontData)[atlas->ConfigData[1].FontDataSize / 2] ^= 1; break;
+    case 1: atlas->ConfigData[2].SizePixels += 1.0f; break;
+    case 2: atlas->ConfigData[3].RasterizerMultiply = 1.2f; break;
+    case 3: atlas->ConfigData[0].GlyphRanges = atlas->GetGlyphRangesDefault(); break;
+    case 4: atlas->Fonts[1]->SetFallbackChar('*'); break;
+    case 5: atlas->Flags |= ImFontAtlasFlags_NoMouseCursors; break;
+    case 6: atlas->TexGlyphPadding = 2; break;
+    case 7: atlas->AddCustomRectRegular(0x10000, 16, 16); break;
+    }
+    const bool rejected = !atlas->LoadBuiltDataFromMemory(GFontAtlasCache.Data, (size_t)GFontAtlasCache.Size);
+    IM_DELETE(atlas);
+    return rejected;
+}
+
+static void BenchSetup_FontsCached()
+{
+    GFontCodepoints.clear();
+    ImFontAtlas* reference = IM_NEW(ImFontAtlas)();
+    BenchAddFontsFullRanges(reference);
+    double t0 = BenchGetTimeMs();
+    reference->Build();
+    double t1 = BenchGetTimeMs();
+    reference->SaveBuiltDataToMemory(&GFontAtlasCache);
+    double t2 = BenchGetTimeMs();
+
+    const int changes_count = 8;
+    int rejected_count = 0;
+    for (int change_n = 0; change_n < changes_count; change_n++)
+        rejected_count += BenchFontAtlasCacheIsRejected(change_n) ? 1 : 0;
+    IM_ASSERT(rejected_count == changes_count && "Font atlas cache wasn't invalidated by a change of inputs");
+
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    BenchAddFontsFullRanges(atlas);
+    double t3 = BenchGetTimeMs();
+    const ImU32 hash = atlas->CalcBuildHash();
+    double t4 = BenchGetTimeMs();
+    const bool loaded = atlas->LoadBuiltDataFromMemory(GFontAtlasCache.Data, (size_t)GFontAtlasCache.Size);
+    double t5 = BenchGetTimeMs();
+    const bool equal = loaded && BenchFontAtlasesEqual(reference, atlas);
+    IM_ASSERT(equal && "Font atlas loaded from cache differs from built atlas");
+    IM_UNUSED(hash);
+    IM_DELETE(reference);
+
+    BenchSetCounter("cache_equal", equal ? 1 : 0);
+    BenchSetCounter("invalidated", rejected_count);
+    BenchSetCounter("cache_kb", GFontAtlasCache.Size / 1024);
+    BenchSetCounter("build_ms", t1 - t0);
+    BenchSetCounter("save_ms", t2 - t1);
+    BenchSetCounter("hash_ms", t4 - t3);
+    BenchSetCounter("load_ms", t5 - t4);
+}
+
+// Distance field fonts: Roboto baked once at 24 px as a distance field (ImFontConfig::Sdf) and as a regular bitmap, drawn at
+// scales from 0.5 to 4 (use --raster --screenshot to compare). The area covered by the distance field glyphs at scale 1
+// (distance to the outline converted to pixel coverage) is checked against the area covered by the regular glyphs.
+static void BenchSetup_FontsSdf()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    atlas->AddFontDefault();
+    ImFontConfig font_cfg;
+    font_cfg.OversampleH = 1;
+    atlas->AddFontFromFileTTF("../../misc/fonts/Roboto-Medium.ttf", 24.0f, &font_cfg);
+    font_cfg.Sdf = true;
+    atlas->AddFontFromFileTTF("../../misc/fonts/Roboto-Medium.ttf", 24.0f, &font_cfg);
+}
+
+static double BenchGlyphCoverage(const ImFontAtlas* atlas, const ImFontGlyph* glyph, int sdf_spread)
+{
+    const int x0 = (int)(glyph->U0 * atlas->TexWidth + 0.5f), x1 = (int)(glyph->U1 * atlas->TexWidth + 0.5f);
+    const int y0 = (int)(glyph->V0 * atlas->TexHeight + 0.5f), y1 = (int)(glyph->V1 * atlas->TexHeight + 0.5f);
+    double coverage = 0.0;
+    for (int y = y0; y < y1; y++)
+        for (int x = x0; x < x1; x++)
+        {
+            const unsigned char texel = atlas->TexPixelsAlpha8[y * atlas->TexWidth + x];
+            coverage += sdf_spread ? ImClamp(0.5 + (texel - 128) * sdf_spread / 128.0, 0.0, 1.0) : texel / 255.0;
+        }
+    return coverage;
+}
+
+static void BenchFrame_FontsSdf()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->Fonts.Size < 3)
+        return;
+    if (atlas->TexIDSdf == atlas->TexID)
+        atlas->TexIDSdf = (ImTextureID)(intptr_t)1; // Without a renderer (no --raster), any distinct identifier will do
+    ImFont* font_regular = atlas->Fonts[1];
+    ImFont* font_sdf = atlas->Fonts[2];
+    IM_ASSERT(!font_regular->Sdf && font_sdf->Sdf);
+
+    static const float scales[] = { 0.5f, 1.0f, 2.0f, 4.0f };
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1900, 1060));
+    ImGui::Begin("Distance Field Fonts");
+    for (int scale_n = 0; scale_n < IM_ARRAYSIZE(scales); scale_n++)
+        for (int font_n = 0; font_n < 2; font_n++)
+        {
+            ImGui::PushFont(font_n ? font_sdf : font_regular);
+            ImGui::SetWindowFontScale(scales[scale_n]);
+            ImGui::Text("%s x%.1f: The quick brown fox jumps over the lazy dog", font_n ? "Sdf" : "Bitmap", scales[scale_n]);
+            ImGui::SetWindowFontScale(1.0f);
+            ImGui::PopFont();
+        }
+    ImGui::End();
+
+    double coverage_regular = 0.0, coverage_sdf = 0.0;
+    for (ImWchar c = 'A'; c <= 'z'; c++)
+    {
+        coverage_regular += BenchGlyphCoverage(atlas, font_regular->FindGlyph(c), 0);
+        coverage_sdf += BenchGlyphCoverage(atlas, font_sdf->FindGlyph(c), font_sdf->ConfigData->SdfSpread);
+    }
+    const double coverage_ratio = coverage_sdf / coverage_regular;
+    IM_ASSERT(coverage_ratio > 0.98 && coverage_ratio < 1.02 && "Distance field glyphs don't match regular glyphs");
+    BenchSetCounter("coverage_ratio", coverage_ratio);
+    BenchSetCounter("tex_w", atlas->TexWidth);
+    BenchSetCounter("tex_h", atlas->TexHeight);
+    BenchSetCounter("sdf_surface", font_sdf->MetricsTotalSurface);
+    BenchSetCounter("bitmap_surface", font_regular->MetricsTotalSurface);
+}
+
+// Distance field default font: text drawn on the foreground and background draw lists, which NewFrame() sets up with the texture of the default font.
+static void BenchSetup_FontsSdfDefault()
+{
+    ImFontConfig font_cfg;
+    font_cfg.OversampleH = 1;
+    font_cfg.Sdf = true;
+    ImGui::GetIO().Fonts->AddFontFromFileTTF("../../misc/fonts/Roboto-Medium.ttf", 24.0f, &font_cfg);
+}
+
+static void BenchPreFrame_FontsSdfDefault()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexIDSdf == atlas->TexID)
+        atlas->TexIDSdf = (ImTextureID)(intptr_t)1; // Without a renderer (no --raster), any distinct identifier will do
+}
+
+static void BenchFrame_FontsSdfDefault()
+{
+    ImFont* font = ImGui::GetFont();
+    if (!font->Sdf)
+        return; // Roboto-Medium.ttf not found
+    ImGui::GetBackgroundDrawList()->AddText(ImVec2(20, 20), IM_COL32(255, 255, 0, 255), "Background draw list text");
+    ImGui::GetForegroundDrawList()->AddText(ImVec2(20, 60), IM_COL32(0, 255, 255, 255), "Foreground draw list text");
+    ImGui::GetForegroundDrawList()->AddText(font, font->FontSize * 2.0f, ImVec2(20, 100), IM_COL32(255, 255, 255, 255), "Foreground draw list text x2");
+    ImGui::SetNextWindowPos(ImVec2(20, 200));
+    ImGui::Begin("Distance Field Default Font");
+    ImGui::Text("The quick brown fox jumps over the lazy dog");
+    ImGui::End();
+}
+
+// Incremental atlas build (ImFontAtlasFlags_Incremental): the default font is built at startup, then a size of Roboto is added before
+// each of the first 8 frames with BuildIncremental(). Compare incremental_ms with rebuilding an atlas with the same fonts (rebuild_ms).
+// All glyphs must have the same metrics and pixels as in the rebuilt atlas, including glyphs built before the texture grew.
+static bool BenchAddFontIncremental(ImFontAtlas* atlas, int n)
+{
+    static void* file_data = NULL;
+    static size_t file_size = 0;
+    if (file_data == NULL && (file_data = ImFileLoadToMemory("../../misc/fonts/Roboto-Medium.ttf", "rb", &file_size)) == NULL)
+        return false;
+    ImFontConfig font_cfg;
+    font_cfg.FontDataOwnedByAtlas = false;
+    atlas->AddFontFromMemoryTTF(file_data, (int)file_size, 14.0f + n * 3.0f, &font_cfg);
+    return true;
+}
+
+static void BenchGlyphTexelRect(const ImFontAtlas* atlas, const ImFontGlyph& glyph, int* x0, int* y0, int* x1, int* y1)
+{
+    *x0 = (int)(glyph.U0 * atlas->TexWidth + 0.5f);
+    *y0 = (int)(glyph.V0 * atlas->TexHeight + 0.5f);
+    *x1 = (int)(glyph.U1 * atlas->TexWidth + 0.5f);
+    *y1 = (int)(glyph.V1 * atlas->TexHeight + 0.5f);
+}
+
+static bool BenchFontGlyphsEqual(const ImFontAtlas* atlas_a, const ImFont* font_a, const ImFontAtlas* atlas_b, const ImFont* font_b)
+{
+    if (font_a->Glyphs.Size != font_b->Glyphs.Size || font_a->FontSize != font_b->FontSize || font_a->Ascent != font_b->Ascent)
+        return false;
+    for (int glyph_i = 0; glyph_i < font_a->Glyphs.Size; glyph_i++)
+    {
+        const ImFontGlyph& ga = font_a->Glyphs[glyph_i];
+        const ImFontGlyph& gb = font_b->Glyphs[glyph_i];
+        if (ga.Codepoint != gb.Codepoint || ga.AdvanceX != gb.AdvanceX || ga.X0 != gb.X0 || ga.Y0 != gb.Y0 || ga.X1 != gb.X1 || ga.Y1 != gb.Y1)
+            return false;
+        int ax0, ay0, ax1, ay1, bx0, by0, bx1, by1;
+        BenchGlyphTexelRect(atlas_a, ga, &ax0, &ay0, &ax1, &ay1);
+        BenchGlyphTexelRect(atlas_b, gb, &bx0, &by0, &bx1, &by1);
+        if (ax1 - ax0 != bx1 - bx0 || ay1 - ay0 != by1 - by0)
+            return false;
+        for (int y = 0; y < ay1 - ay0; y++)
+            if (memcmp(atlas_a->TexPixelsAlpha8 + (ay0 + y) * atlas_a->TexWidth + ax0, atlas_b->TexPixelsAlpha8 + (by0 + y) * atlas_b->TexWidth + bx0, (size_t)(ax1 - ax0)) != 0)
+                return false;
+    }
+    return true;
+}
+
+static void BenchSetup_FontsIncremental()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    atlas->Flags |= ImFontAtlasFlags_Incremental;
+    atlas->AddFontDefault();
+}
+
+static void BenchPreFrame_FontsIncremental()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    const int font_n = atlas->Fonts.Size - 1;
+    if (font_n >= 8)
+        return;
+    atlas->ClearTexDirtyRect(); // Already uploaded by the renderer, if any
+    const int tex_h_old = atlas->TexHeight;
+    if (!BenchAddFontIncremental(atlas, font_n))
+        return;
+    double t0 = BenchGetTimeMs();
+    const bool built = atlas->BuildIncremental();
+    double t1 = BenchGetTimeMs();
+    IM_ASSERT(built && "BuildIncremental() failed");
+    int dirty_x = 0, dirty_y = 0, dirty_w = 0, dirty_h = 0;
+    atlas->GetTexDirtyRect(&dirty_x, &dirty_y, &dirty_w, &dirty_h);
+
+    ImFontAtlas* reference = IM_NEW(ImFontAtlas)();
+    reference->AddFontDefault();
+    for (int n = 0; n <= font_n; n++)
+        BenchAddFontIncremental(reference, n);
+    double t2 = BenchGetTimeMs();
+    reference->Build();
+    double t3 = BenchGetTimeMs();
+    bool equal = (reference->Fonts.Size == atlas->Fonts.Size);
+    for (int n = 0; n < atlas->Fonts.Size && equal; n++)
+        equal = BenchFontGlyphsEqual(atlas, atlas->Fonts[n], reference, reference->Fonts[n]);
+    IM_ASSERT(equal && "Incremental atlas build differs from full build");
+    IM_DELETE(reference);
+    if (atlas->TexPixelsRGBA32)
+        for (int n = 0; n < atlas->TexWidth * atlas->TexHeight; n++)
+            IM_ASSERT(atlas->TexPixelsRGBA32[n] == IM_COL32(255, 255, 255, atlas->TexPixelsAlpha8[n]));
+
+    BenchSetCounter("glyphs_equal", equal ? 1 : 0);
+    BenchSetCounter("fonts", atlas->Fonts.Size);
+    BenchSetCounter("tex_w", atlas->TexWidth);
+    BenchSetCounter("tex_h", atlas->TexHeight);
+    BenchSetCounter("grew", atlas->TexHeight != tex_h_old ? 1 : 0);
+    BenchSetCounter("dirty_w", dirty_w);
+    BenchSetCounter("dirty_h", dirty_h);
+    BenchSetCounter("incremental_ms", t1 - t0);
+    BenchSetCounter("rebuild_ms", t3 - t2);
+}
+
+static void BenchFrame_FontsIncremental()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1400, 1000));
+    ImGui::Begin("Incremental Fonts");
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImGui::PushFont(atlas->Fonts[font_n]);
+        ImGui::Text("%.0f px: The quick brown fox jumps over the lazy dog", atlas->Fonts[font_n]->FontSize);
+        ImGui::PopFont();
+    }
+    ImGui::End();
+}
+
+// Rectangle packers: the same fonts as 'fonts_baked' are built with the default packer, then with ImFontAtlas::PackRectsSkyline()
+// and ImFontAtlas::PackRectsShelf() as ImFontAtlas::BuildPackRects. Glyphs must be identical apart from their position in the
+// texture, and packed rectangles must not overlap. Reports the texture height, packing efficiency, pack and build times of each.
+struct BenchPackRectsTimer
+{
+    ImFontAtlasPackRectsFunc    PackRects;
+    double                      PackMs;
+};
+
+static void BenchPackRectsTimed(ImFontAtlasPackRect* rects, int rects_count, int width, int height_max, void* user_data)
+{
+    BenchPackRectsTimer* timer = (BenchPackRectsTimer*)user_data;
+    double t0 = BenchGetTimeMs();
+    timer->PackRects(rects, rects_count, width, height_max, NULL);
+    timer->PackMs = BenchGetTimeMs() - t0;
+
+    int height = 0;
+    for (int n = 0; n < rects_count; n++)
+        if (rects[n].WasPacked)
+            height = ImMax(height, rects[n].Y + rects[n].H);
+    ImVector<unsigned char> used;
+    used.resize(width * height);
+    memset(used.Data, 0, (size_t)used.Size);
+    for (int n = 0; n < rects_count; n++)
+        if (rects[n].WasPacked)
+            for (int y = rects[n].Y; y < rects[n].Y + rects[n].H; y++)
+                for (int x = rects[n].X; x < rects[n].X + rects[n].W; x++)
+                {
+                    IM_ASSERT(used[y * width + x] == 0 && "Packed rectangles overlap");
+                    used[y * width + x] = 1;
+                }
+}
+
+static void BenchSetup_FontsPackers()
+{
+    static const char* counter_names[3][4] =
+    {
+        { "default_tex_h", "default_efficiency", NULL, "default_build_ms" },
+        { "skyline_tex_h", "skyline_efficiency", "skyline_pack_ms", "skyline_build_ms" },
+        { "shelf_tex_h", "shelf_efficiency", "shelf_pack_ms", "shelf_build_ms" },
+    };
+    static const ImFontAtlasPackRectsFunc packers[3] = { NULL, ImFontAtlas::PackRectsSkyline, ImFontAtlas::PackRectsShelf };
+    ImFontAtlas* atlases[3];
+    for (int n = 0; n < 3; n++)
+    {
+        BenchPackRectsTimer timer = { packers[n], 0.0 };
+        atlases[n] = IM_NEW(ImFontAtlas)();
+        if (packers[n])
+        {
+            atlases[n]->BuildPackRects = BenchPackRectsTimed;
+            atlases[n]->BuildPackRectsUserData = &timer;
+        }
+        if (!BenchAddFontsFullRanges(atlases[n]))
+            atlases[n]->AddFontDefault();
+        double t0 = BenchGetTimeMs();
+        atlases[n]->Build();
+        double t1 = BenchGetTimeMs();
+        atlases[n]->BuildPackRects = NULL;
+
+        bool equal = (atlases[n]->Fonts.Size == atlases[0]->Fonts.Size);
+        for (int font_n = 0; font_n < atlases[n]->Fonts.Size && equal; font_n++)
+            equal = BenchFontGlyphsEqual(atlases[n], atlases[n]->Fonts[font_n], atlases[0], atlases[0]->Fonts[font_n]);
+        IM_ASSERT(equal && "Atlas built with a custom packer has different glyphs");
+
+        BenchSetCounter(counter_names[n][0], atlases[n]->TexHeight);
+        BenchSetCounter(counter_names[n][1], 100.0 * atlases[n]->PackedSurface / ((double)atlases[n]->TexWidth * atlases[n]->PackedHeight));
+        if (packers[n])
+            BenchSetCounter(counter_names[n][2], timer.PackMs);
+        BenchSetCounter(counter_names[n][3], t1 - t0);
+    }
+    BenchSetCounter("rects", atlases[0]->PackedRectsCount);
+    BenchSetCounter("tex_w", atlases[0]->TexWidth);
+    for (int n = 0; n < 3; n++)
+        IM_DELETE(atlases[n]);
+
+    // Frames render the fonts_baked workload with the shelf packer
+    ImGuiIO& io = ImGui::GetIO();
+    io.Fonts->BuildPackRects = ImFontAtlas::PackRectsShelf;
+    BenchSetup_FontsBaked();
+}
+
+static const BenchWorkload GWorkloads[] =
+{
+    { "demo_window",    NULL, BenchFrame_DemoWindow, NULL },
+    { "text_lines_10k", NULL, BenchFrame_TextLines, NULL },
+    { "text_size_cache", BenchSetup_TextSizeCache, BenchFrame_TextSizeCache, NULL },
+    { "text_log_2mb",   BenchSetup_TextLog, BenchFrame_TextLog, NULL },
+    { "text_log_index", BenchSetup_TextLogIndex, BenchFrame_TextLogIndex, NULL },
+    { "text_log_widget", BenchSetup_TextLogWidget, BenchFrame_TextLogWidget, NULL },
+    { "listbox_100k",   NULL, BenchFrame_ListBox, NULL },
+    { "list_variable_heights", BenchSetup_ListVariableHeights, BenchFrame_ListVariableHeights, NULL },
+    { "grid_100k_x_500", BenchSetup_Grid, BenchFrame_Grid, NULL },
+    { "tree_nodes",     NULL, BenchFrame_TreeNodes, NULL },
+    { "many_windows",   NULL, BenchFrame_ManyWindows, NULL },
+    { "windows_hit_test", BenchSetup_WindowsHitTest, BenchFrame_WindowsHitTest, BenchPreFrame_WindowsHitTest },
+    { "windows_hit_test_index", BenchSetup_WindowsHitTestIndex, BenchFrame_WindowsHitTest, BenchPreFrame_WindowsHitTest },
+    { "hash_labels",    BenchSetup_HashLabels, BenchFrame_HashLabels, NULL },
+    { "storage_insert", NULL, BenchFrame_StorageInsert, NULL },
+    { "storage_lookup", BenchSetup_StorageLookup, BenchFrame_StorageLookup, NULL },
+    { "parallel_draw",  NULL, BenchFrame_ParallelDrawLists, NULL },
+    { "batch_primitives", BenchSetup_BatchPrimitives, BenchFrame_BatchPrimitives, NULL },
+    { "polyline_100k",  BenchSetup_Polyline, BenchFrame_Polyline, NULL },
+    { "circles",        NULL, BenchFrame_Circles, NULL },
+    { "fonts_baked",    BenchSetup_FontsBaked, BenchFrame_FontsFullRanges, NULL },
+    { "fonts_dynamic",  BenchSetup_FontsDynamic, BenchFrame_FontsFullRanges, NULL },
+    { "font_index",     BenchSetup_FontsBaked, BenchFrame_FontIndex, NULL },
+    { "fonts_cached",   BenchSetup_FontsCached, BenchFrame_FontsFullRanges, NULL },
+    { "fonts_build_mt", BenchSetup_FontsBuildParallel, BenchFrame_DemoWindow, NULL },
+    { "fonts_sdf",      BenchSetup_FontsSdf, BenchFrame_FontsSdf, NULL },
+    { "fonts_sdf_default", BenchSetup_FontsSdfDefault, BenchFrame_FontsSdfDefault, BenchPreFrame_FontsSdfDefault },
+    { "fonts_incremental", BenchSetup_FontsIncremental, BenchFrame_FontsIncremental, BenchPreFrame_FontsIncremental },
+    { "fonts_packers",  BenchSetup_FontsPackers, BenchFrame_FontsFullRanges, NULL },
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+enum BenchPhase
+{
+    BenchPhase_NewFrame,
+    BenchPhase_Submit,
+    BenchPhase_EndFrame,
+    BenchPhase_Render,
+    BenchPhase_COUNT
+};
+
+static const char* GPhaseNames[BenchPhase_COUNT] = { "new_frame", "submit", "end_frame", "render" };
+
+struct BenchResult
+{
+    double  SetupMs;
+    double  PhaseTotalMs[BenchPhase_COUNT];
+    double  PhaseMinMs[BenchPhase_COUNT];
+    double  FrameMinMs;
+    double  FrameMaxMs;
+    int     VtxCount;                   // From last frame
+    int     IdxCount;                   // From last frame
+    int     CmdListsCount;              // From last frame
+    int     AllocCountPerFrame;         // Average over measured frames
+    size_t  AllocBytesPerFrame;         // Average over measured frames
+};
+
+static void RunWorkload(const BenchWorkload& workload, int warmup_frames, int measure_frames, BenchResult* out)
+{
+    memset(out, 0, sizeof(*out));
+    for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        out->PhaseMinMs[phase] = 1e30;
+    out->FrameMinMs = 1e30;
+
+    GCounters.clear();
+    double t_setup = BenchGetTimeMs();
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.Fonts->BuildParallelFor = (GThreadsCount > 1) ? BenchParallelFor : NULL;
+    io.Fonts->BuildParallelForUserData = &GThreadsCount;
+    if (workload.Setup)
+        workload.Setup();
 
     // Build atlas
-    unsigned char* tex_pixels = NULL;
-    int tex_w, tex_h;
-    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    if (GRasterEnabled)
+    {
+        ImGui_ImplSoftware_Init();
+        ImGui_ImplSoftware_SetParallelFor(GThreadsCount > 1 ? BenchParallelFor : NULL, &GThreadsCount, GThreadsCount * 4);
+        ImGui_ImplSoftware_CreateFontsTexture();
+    }
+    else
+    {
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    }
+    out->SetupMs = BenchGetTimeMs() - t_setup;
+    const int fb_width = 1920, fb_height = 1080;
+    double raster_total_ms = 0.0, raster_min_ms = 1e30;
 
-    for (int n = 0; n < 20; n++)
+    int alloc_count_at_start = 0;
+    size_t alloc_bytes_at_start = 0;
+    for (int frame = 0; frame < warmup_frames + measure_frames; frame++)
     {
-        printf("NewFrame() %d\n", n);
-        io.DisplaySize = ImVec2(1920, 1080);
+        const bool measure = (frame >= warmup_frames);
+        if (frame == warmup_frames)
+        {
+            alloc_count_at_start = GAllocStats.AllocCount;
+            alloc_bytes_at_start = GAllocStats.AllocBytes;
+        }
+
+        io.DisplaySize = ImVec2((float)fb_width, (float)fb_height);
         io.DeltaTime = 1.0f / 60.0f;
+
+        if (workload.PreFrame)
+            workload.PreFrame();
+        double t[BenchPhase_COUNT + 1];
+        t[0] = BenchGetTimeMs();
         ImGui::NewFrame();
+        t[1] = BenchGetTimeMs();
+        workload.Frame();
+        t[2] = BenchGetTimeMs();
+        ImGui::EndFrame();
+        t[3] = BenchGetTimeMs();
+        ImGui::Render();
+        t[4] = BenchGetTimeMs();
 
-        static float f = 0.0f;
-        ImGui::Text("Hello, world!");
-        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
-        ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
-        ImGui::ShowDemoWindow(NULL);
+        if (GRasterEnabled)
+        {
+            GFramebuffer.resize(fb_width * fb_height);
+            for (int n = 0; n < GFramebuffer.Size; n++)
+                GFramebuffer[n] = IM_COL32(114, 140, 153, 255);
+            double t_raster = BenchGetTimeMs();
+            ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), GFramebuffer.Data, fb_width, fb_height, fb_width * (int)sizeof(ImU32));
+            t_raster = BenchGetTimeMs() - t_raster;
+            if (measure)
+            {
+                raster_total_ms += t_raster;
+                if (t_raster < raster_min_ms)
+                    raster_min_ms = t_raster;
+            }
+        }
 
-        ImGui::Render();
+        if (!measure)
+            continue;
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        {
+            double dt = t[phase + 1] - t[phase];
+            out->PhaseTotalMs[phase] += dt;
+            if (dt < out->PhaseMinMs[phase])
+                out->PhaseMinMs[phase] = dt;
+        }
+        double frame_ms = t[BenchPhase_COUNT] - t[0];
+        if (frame_ms < out->FrameMinMs)
+            out->FrameMinMs = frame_ms;
+        if (frame_ms > out->FrameMaxMs)
+            out->FrameMaxMs = frame_ms;
+    }
+
+    if (measure_frames > 0)
+    {
+        out->AllocCountPerFrame = (GAllocStats.AllocCount - alloc_count_at_start) / measure_frames;
+        out->AllocBytesPerFrame = (GAllocStats.AllocBytes - alloc_bytes_at_start) / measure_frames;
+    }
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    out->VtxCount = draw_data->TotalVtxCount;
+    out->IdxCount = draw_data->TotalIdxCount;
+    out->CmdListsCount = draw_data->CmdListsCount;
+
+    if (GRasterEnabled)
+    {
+        if (measure_frames > 0)
+        {
+            BenchSetCounter("raster_avg_ms", raster_total_ms / measure_frames);
+            BenchSetCounter("raster_min_ms", raster_min_ms);
+        }
+        if (GScreenshotPrefix && GFramebuffer.Size == fb_width * fb_height)
+        {
+            char filename[512];
+            snprintf(filename, IM_ARRAYSIZE(filename), "%s%s.ppm", GScreenshotPrefix, workload.Name);
+            if (!BenchWriteScreenshot(filename, GFramebuffer.Data, fb_width, fb_height))
+                fprintf(stderr, "Failed to write '%s'\n", filename);
+        }
+        ImGui_ImplSoftware_Shutdown();
     }
 
-    printf("DestroyContext()\n");
     ImGui::DestroyContext();
+}
+
+static void PrintResult(const BenchWorkload& workload, const BenchResult& r, int measure_frames, bool json)
+{
+    const double inv_frames = measure_frames > 0 ? 1.0 / measure_frames : 0.0;
+    if (json)
+    {
+        printf("{\"workload\":\"%s\",\"frames\":%d,\"setup_ms\":%.4f", workload.Name, measure_frames, r.SetupMs);
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            printf(",\"%s_avg_ms\":%.4f,\"%s_min_ms\":%.4f", GPhaseNames[phase], r.PhaseTotalMs[phase] * inv_frames, GPhaseNames[phase], r.PhaseMinMs[phase]);
+        printf(",\"frame_min_ms\":%.4f,\"frame_max_ms\":%.4f", r.FrameMinMs, r.FrameMaxMs);
+        printf(",\"vtx_count\":%d,\"idx_count\":%d,\"cmd_lists\":%d", r.VtxCount, r.IdxCount, r.CmdListsCount);
+        printf(",\"allocs_per_frame\":%d,\"alloc_bytes_per_frame\":%d", r.AllocCountPerFrame, (int)r.AllocBytesPerFrame);
+        for (int n = 0; n < GCounters.Size; n++)
+            printf(",\"%s\":%.10g", GCounters[n].Name, GCounters[n].Value);
+        printf("}\n");
+    }
+    else
+    {
+        double frame_avg = 0.0;
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            frame_avg += r.PhaseTotalMs[phase] * inv_frames;
+        printf("%-20s %8.3f %9.4f %9.4f %9.4f %9.4f %9.4f %8d %8d %7d", workload.Name, r.SetupMs,
+            r.PhaseTotalMs[BenchPhase_NewFrame] * inv_frames, r.PhaseTotalMs[BenchPhase_Submit] * inv_frames,
+            r.PhaseTotalMs[BenchPhase_EndFrame] * inv_frames, r.PhaseTotalMs[BenchPhase_Render] * inv_frames,
+            frame_avg, r.VtxCount, r.IdxCount, r.AllocCountPerFrame);
+        for (int n = 0; n < GCounters.Size; n++)
+            printf(" %s=%.10g", GCounters[n].Name, GCounters[n].Value);
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int warmup_frames = 10;
+    int measure_frames = 100;
+    const char* filter = NULL;
+    bool json = false;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            measure_frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--warmup") == 0 && n + 1 < argc)
+            warmup_frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--filter") == 0 && n + 1 < argc)
+            filter = argv[++n];
+        else if (strcmp(argv[n], "--json") == 0)
+            json = true;
+        else if (strcmp(argv[n], "--raster") == 0)
+            GRasterEnabled = true;
+        else if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)
+            GThreadsCount = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--screenshot") == 0 && n + 1 < argc)
+            GScreenshotPrefix = argv[++n], GRasterEnabled = true;
+        else if (strcmp(argv[n], "--list") == 0)
+        {
+            for (int i = 0; i < IM_ARRAYSIZE(GWorkloads); i++)
+                printf("%s\n", GWorkloads[i].Name);
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--filter substring] [--json] [--list] [--raster] [--threads N] [--screenshot prefix]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(BenchMemAlloc, BenchMemFree, &GAllocStats);
+
+    if (!json)
+        printf("%-20s %8s %9s %9s %9s %9s %9s %8s %8s %7s\n", "workload", "setup", "newframe", "submit", "endframe", "render", "frame", "vtx", "idx", "allocs");
+    for (int n = 0; n < IM_ARRAYSIZE(GWorkloads); n++)
+    {
+        const BenchWorkload& workload = GWorkloads[n];
+        if (filter && strstr(workload.Name, filter) == NULL)
+            continue;
+        BenchResult result;
+        RunWorkload(workload, warmup_frames, measure_frames, &result);
+        PrintResult(workload, result, measure_frames, json);
+    }
+    BenchDeleteDrawLists(&GDrawChunkLists);
+    BenchDeleteDrawLists(&GBatchLists);
+    BenchDeleteDrawLists(&GPolylineLists);
     return 0;
 }
@@ -3,6 +3,7 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'ID3D11ShaderResourceView*' as ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Font texture stored with 1 byte per texel (DXGI_FORMAT_R8_UNORM), using a second pixel shader.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp
@@ -10,6 +11,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: DirectX11: Font texture uses DXGI_FORMAT_R8_UNORM with a second pixel shader, so the font atlas is never converted to RGBA32 unless the application requested it.
 //  2019-04-30: DirectX11: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2018-12-03: Misc: Added #pragma comment statement to automatically link with d3dcompiler.lib when using D3DCompile().
 //  2018-11-30: Misc: Setting up io.BackendRendererName so it can be displayed in the About Window.
@@ -44,8 +46,11 @@ static ID3D11InputLayout*       g_pInputLayout = NULL;
 static ID3D11Buffer*            g_pVertexConstantBuffer = NULL;
 static ID3D10Blob*              g_pPixelShaderBlob = NULL;
 static ID3D11PixelShader*       g_pPixelShader = NULL;
+static ID3D10Blob*              g_pPixelShaderAlpha8Blob = NULL;
+static ID3D11PixelShader*       g_pPixelShaderAlpha8 = NULL;    // Used with g_pFontTextureView when it is DXGI_FORMAT_R8_UNORM (no swizzle in D3D11 views)
 static ID3D11SamplerState*      g_pFontSampler = NULL;
 static ID3D11ShaderResourceView*g_pFontTextureView = NULL;
+static bool                     g_FontTextureAlpha8 = false;
 static ID3D11RasterizerState*   g_pRasterizerState = NULL;
 static ID3D11BlendState*        g_pBlendState = NULL;
 static ID3D11DepthStencilState* g_pDepthStencilState = NULL;
@@ -216,6 +221,7 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     int vtx_offset = 0;
     int idx_offset = 0;
     ImVec2 clip_off = draw_data->DisplayPos;
+    ID3D11PixelShader* current_ps = g_pPixelShader;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -227,9 +233,14 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplDX11_SetupRenderState(draw_data, ctx);
+                    current_ps = g_pPixelShader;
+                }
                 else
+                {
                     pcmd->UserCallback(cmd_list, pcmd);
+                }
             }
             else
             {
@@ -237,8 +248,14 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 const D3D11_RECT r = { (LONG)(pcmd->ClipRect.x - clip_off.x), (LONG)(pcmd->ClipRect.y - clip_off.y), (LONG)(pcmd->ClipRect.z - clip_off.x), (LONG)(pcmd->ClipRect.w - clip_off.y) };
                 ctx->RSSetScissorRects(1, &r);
 
-                // Bind texture, Draw
+                // Bind texture and matching pixel shader, Draw
                 ID3D11ShaderResourceView* texture_srv = (ID3D11ShaderResourceView*)pcmd->TextureId;
+                ID3D11PixelShader* ps = (g_FontTextureAlpha8 && texture_srv == g_pFontTextureView) ? g_pPixelShaderAlpha8 : g_pPixelShader;
+                if (ps != current_ps)
+                {
+                    ctx->PSSetShader(ps, NULL, 0);
+                    current_ps = ps;
+                }
                 ctx->PSSetShaderResources(0, 1, &texture_srv);
                 ctx->DrawIndexed(pcmd->ElemCount, idx_offset, vtx_offset);
             }
@@ -269,10 +286,17 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 static void ImGui_ImplDX11_CreateFontsTexture()
 {
     // Build texture atlas
+    // Load as Alpha8 into a DXGI_FORMAT_R8_UNORM texture, drawn with g_pPixelShaderAlpha8, so the atlas is never converted to RGBA32.
+    // Load as RGBA32 if the application already requested RGBA32 data (e.g. to store colored custom rectangles).
     ImGuiIO& io = ImGui::GetIO();
+    g_FontTextureAlpha8 = (io.Fonts->TexPixelsRGBA32 == NULL);
     unsigned char* pixels;
-    int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    int width, height, bytes_per_pixel;
+    if (g_FontTextureAlpha8)
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+    else
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);
+    const DXGI_FORMAT format = g_FontTextureAlpha8 ? DXGI_FORMAT_R8_UNORM : DXGI_FORMAT_R8G8B8A8_UNORM;
 
     // Upload texture to graphics system
     {
@@ -282,7 +306,7 @@ static void ImGui_ImplDX11_CreateFontsTexture()
         desc.Height = height;
         desc.MipLevels = 1;
         desc.ArraySize = 1;
-        desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        desc.Format = format;
         desc.SampleDesc.Count = 1;
         desc.Usage = D3D11_USAGE_DEFAULT;
         desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
@@ -291,14 +315,14 @@ static void ImGui_ImplDX11_CreateFontsTexture()
         ID3D11Texture2D *pTexture = NULL;
         D3D11_SUBRESOURCE_DATA subResource;
         subResource.pSysMem = pixels;
-        subResource.SysMemPitch = desc.Width * 4;
+        subResource.SysMemPitch = desc.Width * bytes_per_pixel;
         subResource.SysMemSlicePitch = 0;
         g_pd3dDevice->CreateTexture2D(&desc, &subResource, &pTexture);
 
         // Create texture view
         D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
         ZeroMemory(&srvDesc, sizeof(srvDesc));
-        srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        srvDesc.Format = format;
         srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Texture2D.MipLevels = desc.MipLevels;
         srvDesc.Texture2D.MostDetailedMip = 0;
@@ -421,6 +445,31 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
             return false;
     }
 
+    // Create the pixel shader for the font texture stored as DXGI_FORMAT_R8_UNORM, sampled as (R,0,0,1): we use (1,1,1,R)
+    {
+        static const char* pixelShaderAlpha8 =
+            "struct PS_INPUT\
+            {\
+            float4 pos : SV_POSITION;\
+            float4 col : COLOR0;\
+            float2 uv  : TEXCOORD0;\
+            };\
+            sampler sampler0;\
+            Texture2D texture0;\
+            \
+            float4 main(PS_INPUT input) : SV_Target\
+            {\
+            float4 out_col = input.col * float4(1.0, 1.0, 1.0, texture0.Sample(sampler0, input.uv).r); \
+            return out_col; \
+            }";
+
+        D3DCompile(pixelShaderAlpha8, strlen(pixelShaderAlpha8), NULL, NULL, NULL, "main", "ps_4_0", 0, 0, &g_pPixelShaderAlpha8Blob, NULL);
+        if (g_pPixelShaderAlpha8Blob == NULL)
+            return false;
+        if (g_pd3dDevice->CreatePixelShader((DWORD*)g_pPixelShaderAlpha8Blob->GetBufferPointer(), g_pPixelShaderAlpha8Blob->GetBufferSize(), NULL, &g_pPixelShaderAlpha8) != S_OK)
+            return false;
+    }
+
     // Create the blending setup
     {
         D3D11_BLEND_DESC desc;
@@ -482,6 +531,8 @@ void    ImGui_ImplDX11_InvalidateDeviceObjects()
     if (g_pRasterizerState) { g_pRasterizerState->Release(); g_pRasterizerState = NULL; }
     if (g_pPixelShader) { g_pPixelShader->Release(); g_pPixelShader = NULL; }
     if (g_pPixelShaderBlob) { g_pPixelShaderBlob->Release(); g_pPixelShaderBlob = NULL; }
+    if (g_pPixelShaderAlpha8) { g_pPixelShaderAlpha8->Release(); g_pPixelShaderAlpha8 = NULL; }
+    if (g_pPixelShaderAlpha8Blob) { g_pPixelShaderAlpha8Blob->Release(); g_pPixelShaderAlpha8Blob = NULL; }
     if (g_pVertexConstantBuffer) { g_pVertexConstantBuffer->Release(); g_pVertexConstantBuffer = NULL; }
     if (g_pInputLayout) { g_pInputLayout->Release(); g_pInputLayout = NULL; }
     if (g_pVertexShader) { g_pVertexShader->Release(); g_pVertexShader = NULL; }
@@ -12,6 +12,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Font texture uses 1 byte per texel (GL_R8 + texture swizzle) on GL 3.3+ and GL ES 3.0, so the font atlas is never converted to RGBA32 unless the application requested it.
+//  2026-10-18: OpenGL: Reallocate the font texture when the font atlas grew (ImFontAtlasFlags_Incremental).
+//  2026-10-18: OpenGL: Added a second shader program to draw distance field fonts (ImFontConfig::Sdf), selected by ImFontAtlas::TexIDSdf.
+//  2026-10-18: OpenGL: Upload the region of the font atlas modified after the texture was created (ImFontAtlas::GetTexDirtyRect()), needed by ImFontAtlasFlags_DynamicGlyphs.
+//  2026-10-18: OpenGL: In persistent buffers mode, skip uploading command lists whose ImDrawList::ContentSignature and buffer offsets are unchanged since the last frame (sets ImGuiBackendFlags_RendererUsesContentSignatures).
+//  2026-10-18: OpenGL: Added ImGui_ImplOpenGL3_SetPersistentBuffers() to keep one growing vertex/index buffer for the whole ImDrawData, updated with glBufferSubData() and drawn with glDrawElementsBaseVertex() (GL 3.2+). Added ImGui_ImplOpenGL3_GetRenderStats().
 //  2019-04-30: OpenGL: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-03-29: OpenGL: Not calling glBindBuffer more than necessary in the render loop.
 //  2019-03-15: OpenGL: Added a dummy GL call + comments in ImGui_ImplOpenGL3_Init() to detect uninitialized GL function loaders early.
@@ -102,13 +108,35 @@
 #endif
 #endif
 
+// Desktop GL 3.2+ has glDrawElementsBaseVertex() which we use to draw from persistent buffers. Availability is checked at runtime.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_3_2)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BASE_VERTEX
+#endif
+
 // OpenGL Data
 static char         g_GlslVersionString[32] = "";
 static GLuint       g_FontTexture = 0;
+static int          g_FontTextureWidth = 0, g_FontTextureHeight = 0;                                     // Size of g_FontTexture, to detect atlas growing (ImFontAtlasFlags_Incremental)
+static bool         g_FontTextureAlpha8 = false;                                                        // g_FontTexture is GL_R8 swizzled to (1,1,1,R), uploaded from ImFontAtlas::GetTexDataAsAlpha8()
 static GLuint       g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
+static GLuint       g_ShaderHandleSdf = 0, g_FragHandleSdf = 0;                                          // Same vertex shader, fragment shader thresholding the font texture as a distance field. 0 if it failed to compile.
 static int          g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;                                // Uniforms location
+static int          g_AttribLocationTexSdf = 0, g_AttribLocationProjMtxSdf = 0;
 static int          g_AttribLocationVtxPos = 0, g_AttribLocationVtxUV = 0, g_AttribLocationVtxColor = 0; // Vertex attributes location
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
+static GLuint       g_GlVersion = 0;                                                                    // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
+static bool         g_UsePersistentBuffers = false;
+static GLsizeiptr   g_VboSize = 0, g_ElementsSize = 0;                                                  // Allocated size of persistent buffers, in bytes
+static ImGui_ImplOpenGL3_RenderStats g_RenderStats;
+
+// Content of the persistent buffers for each command list index, as uploaded on the last frame
+struct ImGui_ImplOpenGL3_UploadedList
+{
+    ImU64       Signature;      // ImDrawList::ContentSignature (0: unknown)
+    GLintptr    VtxOffset;
+    GLintptr    IdxOffset;
+};
+static ImVector<ImGui_ImplOpenGL3_UploadedList> g_UploadedLists;
 
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
@@ -127,6 +155,16 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (glsl_version == NULL)
         glsl_version = "#version 130";
 #endif
+    // Query for GL version (GL_MAJOR_VERSION/GL_MINOR_VERSION are only available in GL 3.0+ and GL ES 3.0+, older versions leave them untouched)
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    g_GlVersion = (GLuint)(major * 100 + minor * 10);
+#else
+    g_GlVersion = 200; // GLES 2
+#endif
+
     IM_ASSERT((int)strlen(glsl_version) + 2 < IM_ARRAYSIZE(g_GlslVersionString));
     strcpy(g_GlslVersionString, glsl_version);
     strcat(g_GlslVersionString, "\n");
@@ -143,6 +181,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 void    ImGui_ImplOpenGL3_Shutdown()
 {
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
+    ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererUsesContentSignatures;
 }
 
 void    ImGui_ImplOpenGL3_NewFrame()
@@ -151,6 +190,30 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+bool    ImGui_ImplOpenGL3_SetPersistentBuffers(bool enabled)
+{
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BASE_VERTEX
+    g_UsePersistentBuffers = enabled && g_GlVersion >= 320;
+#else
+    (void)enabled;
+    g_UsePersistentBuffers = false;
+#endif
+    // Content signatures are only useful when buffer contents persist between frames
+    ImGuiIO& io = ImGui::GetIO();
+    if (g_UsePersistentBuffers)
+        io.BackendFlags |= ImGuiBackendFlags_RendererUsesContentSignatures;
+    else
+        io.BackendFlags &= ~ImGuiBackendFlags_RendererUsesContentSignatures;
+    io.MetricsRenderListsSkipped = 0;
+    g_UploadedLists.clear();
+    return g_UsePersistentBuffers == enabled;
+}
+
+const ImGui_ImplOpenGL3_RenderStats* ImGui_ImplOpenGL3_GetRenderStats()
+{
+    return &g_RenderStats;
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
@@ -178,6 +241,12 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (g_ShaderHandleSdf)
+    {
+        glUseProgram(g_ShaderHandleSdf);
+        glUniform1i(g_AttribLocationTexSdf, 0);
+        glUniformMatrix4fv(g_AttribLocationProjMtxSdf, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(g_ShaderHandle);
     glUniform1i(g_AttribLocationTex, 0);
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -201,6 +270,142 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+// Grow persistent buffers if needed (bound to GL_ARRAY_BUFFER/GL_ELEMENT_ARRAY_BUFFER by ImGui_ImplOpenGL3_SetupRenderState)
+// and upload each command list at its offset in the buffers.
+// We use glBufferSubData() instead of mapping the buffers to stay compatible with GL 3.2 and to avoid synchronization issues.
+// Command lists with the same content signature at the same offsets as on the last frame are already in the buffers and are skipped.
+static void ImGui_ImplOpenGL3_UploadPersistentBuffers(ImDrawData* draw_data)
+{
+    bool reallocated = false;
+    const GLsizeiptr vtx_size = (GLsizeiptr)draw_data->TotalVtxCount * (GLsizeiptr)sizeof(ImDrawVert);
+    const GLsizeiptr idx_size = (GLsizeiptr)draw_data->TotalIdxCount * (GLsizeiptr)sizeof(ImDrawIdx);
+    if (g_VboSize < vtx_size)
+    {
+        g_VboSize = vtx_size + vtx_size / 2;
+        glBufferData(GL_ARRAY_BUFFER, g_VboSize, NULL, GL_DYNAMIC_DRAW);
+        g_RenderStats.BufferReallocations++;
+        reallocated = true;
+    }
+    if (g_ElementsSize < idx_size)
+    {
+        g_ElementsSize = idx_size + idx_size / 2;
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, g_ElementsSize, NULL, GL_DYNAMIC_DRAW);
+        g_RenderStats.BufferReallocations++;
+        reallocated = true;
+    }
+
+    // Reallocating storage discards the previous contents
+    const int prev_uploaded_count = reallocated ? 0 : g_UploadedLists.Size;
+    g_UploadedLists.resize(draw_data->CmdListsCount);
+
+    GLintptr vtx_offset = 0;
+    GLintptr idx_offset = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const GLsizeiptr list_vtx_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (GLsizeiptr)sizeof(ImDrawVert);
+        const GLsizeiptr list_idx_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (GLsizeiptr)sizeof(ImDrawIdx);
+        ImGui_ImplOpenGL3_UploadedList& uploaded = g_UploadedLists[n];
+        if (n < prev_uploaded_count && cmd_list->ContentSignature != 0 && uploaded.Signature == cmd_list->ContentSignature && uploaded.VtxOffset == vtx_offset && uploaded.IdxOffset == idx_offset)
+        {
+            g_RenderStats.ListsSkipped++;
+            vtx_offset += list_vtx_size;
+            idx_offset += list_idx_size;
+            continue;
+        }
+        uploaded.Signature = cmd_list->ContentSignature;
+        uploaded.VtxOffset = vtx_offset;
+        uploaded.IdxOffset = idx_offset;
+        glBufferSubData(GL_ARRAY_BUFFER, vtx_offset, list_vtx_size, (const GLvoid*)cmd_list->VtxBuffer.Data);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, idx_offset, list_idx_size, (const GLvoid*)cmd_list->IdxBuffer.Data);
+        g_RenderStats.BytesUploaded += (int)(list_vtx_size + list_idx_size);
+        vtx_offset += list_vtx_size;
+        idx_offset += list_idx_size;
+    }
+    ImGui::GetIO().MetricsRenderListsSkipped = g_RenderStats.ListsSkipped;
+}
+
+// Texture swizzles (GL_TEXTURE_SWIZZLE_R etc.) are core in GL 3.3 and GL ES 3.0
+static bool ImGui_ImplOpenGL3_HasTextureSwizzle()
+{
+#if defined(IMGUI_IMPL_OPENGL_ES2) || !defined(GL_TEXTURE_SWIZZLE_R)
+    return false;
+#elif defined(IMGUI_IMPL_OPENGL_ES3)
+    return true;
+#else
+    return g_GlVersion >= 330;
+#endif
+}
+
+// Retrieve the font atlas pixels in the format of g_FontTexture
+static void ImGui_ImplOpenGL3_GetFontsTexData(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    if (g_FontTextureAlpha8)
+        io.Fonts->GetTexDataAsAlpha8(out_pixels, out_width, out_height, out_bytes_per_pixel);
+    else
+        io.Fonts->GetTexDataAsRGBA32(out_pixels, out_width, out_height, out_bytes_per_pixel);
+}
+
+// Allocate the storage of the bound font texture and upload all its pixels. The caller sets GL_UNPACK_ALIGNMENT to 1.
+static void ImGui_ImplOpenGL3_FontsTexImage2D(int width, int height, const unsigned char* pixels)
+{
+#ifdef GL_TEXTURE_SWIZZLE_R
+    if (g_FontTextureAlpha8)
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+        return;
+    }
+#endif
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+}
+
+// Upload the region of the atlas modified since the texture was created (e.g. glyphs rasterized on demand with ImFontAtlasFlags_DynamicGlyphs)
+// If fonts were added with ImFontAtlasFlags_Incremental, the atlas may have grown: we reallocate the texture storage, keeping the same texture name.
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    int x, y, w, h;
+    if (!g_FontTexture || !io.Fonts->GetTexDirtyRect(&x, &y, &w, &h))
+        return;
+    unsigned char* pixels;
+    int width, height, bytes_per_pixel;
+    ImGui_ImplOpenGL3_GetFontsTexData(&pixels, &width, &height, &bytes_per_pixel);
+
+    GLint last_texture, last_unpack_alignment;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    if (width != g_FontTextureWidth || height != g_FontTextureHeight)
+    {
+        ImGui_ImplOpenGL3_FontsTexImage2D(width, height, pixels);
+        g_FontTextureWidth = width;
+        g_FontTextureHeight = height;
+    }
+    else
+    {
+#ifdef GL_UNPACK_ROW_LENGTH
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+#else
+        x = 0;  // Upload whole rows
+        w = width;
+#endif
+#ifdef GL_TEXTURE_SWIZZLE_R
+        const GLenum format = g_FontTextureAlpha8 ? GL_RED : GL_RGBA;
+#else
+        const GLenum format = GL_RGBA;
+#endif
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, format, GL_UNSIGNED_BYTE, pixels + ((size_t)y * width + x) * bytes_per_pixel);
+#ifdef GL_UNPACK_ROW_LENGTH
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment);
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+    io.Fonts->ClearTexDirtyRect();
+}
+
 // OpenGL3 Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly, in order to be able to run within any OpenGL engine that doesn't do so.
@@ -209,8 +414,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
     int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
     int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    memset(&g_RenderStats, 0, sizeof(g_RenderStats));
     if (fb_width <= 0 || fb_height <= 0)
         return;
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
 
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
@@ -255,19 +462,35 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
+    // Upload all command lists at once into persistent buffers
+    const bool use_persistent_buffers = g_UsePersistentBuffers;
+    if (use_persistent_buffers)
+        ImGui_ImplOpenGL3_UploadPersistentBuffers(draw_data);
+
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+    // Distance field fonts use the font texture with our second program (see ImGui_ImplOpenGL3_CreateFontsTexture)
+    const ImTextureID sdf_texture_id = ImGui::GetIO().Fonts->TexIDSdf;
+    bool program_is_sdf = false;
+
     // Render command lists
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-        size_t idx_buffer_offset = 0;
+        size_t idx_buffer_offset = use_persistent_buffers ? (size_t)global_idx_offset * sizeof(ImDrawIdx) : 0;
 
         // Upload vertex/index buffers
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+        if (!use_persistent_buffers)
+        {
+            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+            g_RenderStats.BytesUploaded += cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert) + cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+            g_RenderStats.BufferReallocations += 2;
+        }
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -277,7 +500,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    program_is_sdf = false;
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -298,13 +524,27 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     else
                         glScissor((int)clip_rect.x, (int)clip_rect.y, (int)clip_rect.z, (int)clip_rect.w); // Support for GL 4.5 rarely used glClipControl(GL_UPPER_LEFT)
 
-                    // Bind texture, Draw
-                    glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
+                    // Bind texture and program, Draw
+                    const bool use_sdf = (sdf_texture_id != NULL && pcmd->TextureId == sdf_texture_id);
+                    if (use_sdf != program_is_sdf)
+                    {
+                        glUseProgram(use_sdf ? g_ShaderHandleSdf : g_ShaderHandle);
+                        program_is_sdf = use_sdf;
+                    }
+                    glBindTexture(GL_TEXTURE_2D, use_sdf ? g_FontTexture : (GLuint)(intptr_t)pcmd->TextureId);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BASE_VERTEX
+                    if (use_persistent_buffers)
+                        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)idx_buffer_offset, (GLint)global_vtx_offset);
+                    else
+#endif
                     glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)idx_buffer_offset);
+                    g_RenderStats.DrawCalls++;
                 }
             }
             idx_buffer_offset += pcmd->ElemCount * sizeof(ImDrawIdx);
         }
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_idx_offset += cmd_list->IdxBuffer.Size;
     }
 
     // Destroy the temporary VAO
@@ -339,25 +579,45 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 bool ImGui_ImplOpenGL3_CreateFontsTexture()
 {
     // Build texture atlas
+    // Load as Alpha8 when texture swizzles are available: the texture returns (1,1,1,R) to our shaders, so the atlas is never converted to RGBA32.
+    // Load as RGBA 32-bits otherwise (75% of the memory is wasted), or if the application already requested RGBA32 data (e.g. to store colored custom rectangles).
     ImGuiIO& io = ImGui::GetIO();
+    g_FontTextureAlpha8 = ImGui_ImplOpenGL3_HasTextureSwizzle() && io.Fonts->TexPixelsRGBA32 == NULL;
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bits (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    ImGui_ImplOpenGL3_GetFontsTexData(&pixels, &width, &height, NULL);
 
     // Upload texture to graphics system
-    GLint last_texture;
+    GLint last_texture, last_unpack_alignment;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
     glGenTextures(1, &g_FontTexture);
     glBindTexture(GL_TEXTURE_2D, g_FontTexture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+#ifdef GL_TEXTURE_SWIZZLE_R
+    if (g_FontTextureAlpha8)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED);
+    }
+#endif
 #ifdef GL_UNPACK_ROW_LENGTH
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    ImGui_ImplOpenGL3_FontsTexImage2D(width, height, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment);
+    g_FontTextureWidth = width;
+    g_FontTextureHeight = height;
 
     // Store our identifier
+    // TexIDSdf only needs to be distinct from any texture name: we use the address of our texture name, and bind g_FontTexture when we see it.
     io.Fonts->TexID = (ImTextureID)(intptr_t)g_FontTexture;
+    io.Fonts->TexIDSdf = g_ShaderHandleSdf ? (ImTextureID)&g_FontTexture : (ImTextureID)NULL;
+    io.Fonts->ClearTexDirtyRect();
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -371,7 +631,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     {
         ImGuiIO& io = ImGui::GetIO();
         glDeleteTextures(1, &g_FontTexture);
-        io.Fonts->TexID = 0;
+        io.Fonts->TexID = io.Fonts->TexIDSdf = 0;
         g_FontTexture = 0;
     }
 }
@@ -527,28 +787,87 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
         "}\n";
 
+    // Distance field fonts (ImFontConfig::Sdf): the distance is stored in the alpha channel, 128/255 on the glyph outline.
+    // We antialias over the screen-space footprint of a pixel, so glyphs stay sharp at any scale.
+    const GLchar* fragment_shader_sdf_glsl_120 =
+        "#ifdef GL_ES\n"
+        "    #extension GL_OES_standard_derivatives : enable\n"
+        "    precision mediump float;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "varying vec2 Frag_UV;\n"
+        "varying vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture2D(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d), 0.0001);\n"
+        "    gl_FragColor = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.502 - w, 0.502 + w, d));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d), 0.0001);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.502 - w, 0.502 + w, d));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d), 0.0001);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.502 - w, 0.502 + w, d));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = max(fwidth(d), 0.0001);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.502 - w, 0.502 + w, d));\n"
+        "}\n";
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = NULL;
     const GLchar* fragment_shader = NULL;
+    const GLchar* fragment_shader_sdf = NULL;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
         fragment_shader = fragment_shader_glsl_120;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_120;
     }
     else if (glsl_version >= 410)
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
     // Create shaders
@@ -576,6 +895,35 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     g_AttribLocationVtxUV = glGetAttribLocation(g_ShaderHandle, "UV");
     g_AttribLocationVtxColor = glGetAttribLocation(g_ShaderHandle, "Color");
 
+    // Distance field program, sharing the vertex shader and the attributes locations of the main program.
+    // This is optional (e.g. GL ES 2.0 without GL_OES_standard_derivatives): on failure we leave ImFontAtlas::TexIDSdf to NULL.
+    const GLchar* fragment_shader_sdf_with_version[2] = { g_GlslVersionString, fragment_shader_sdf };
+    g_FragHandleSdf = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(g_FragHandleSdf, 2, fragment_shader_sdf_with_version, NULL);
+    glCompileShader(g_FragHandleSdf);
+    if (CheckShader(g_FragHandleSdf, "distance field fragment shader"))
+    {
+        g_ShaderHandleSdf = glCreateProgram();
+        glAttachShader(g_ShaderHandleSdf, g_VertHandle);
+        glAttachShader(g_ShaderHandleSdf, g_FragHandleSdf);
+        glBindAttribLocation(g_ShaderHandleSdf, (GLuint)g_AttribLocationVtxPos, "Position");
+        glBindAttribLocation(g_ShaderHandleSdf, (GLuint)g_AttribLocationVtxUV, "UV");
+        glBindAttribLocation(g_ShaderHandleSdf, (GLuint)g_AttribLocationVtxColor, "Color");
+        glLinkProgram(g_ShaderHandleSdf);
+        if (CheckProgram(g_ShaderHandleSdf, "distance field shader program"))
+        {
+            g_AttribLocationTexSdf = glGetUniformLocation(g_ShaderHandleSdf, "Texture");
+            g_AttribLocationProjMtxSdf = glGetUniformLocation(g_ShaderHandleSdf, "ProjMtx");
+        }
+        else
+        {
+            glDetachShader(g_ShaderHandleSdf, g_VertHandle);
+            glDetachShader(g_ShaderHandleSdf, g_FragHandleSdf);
+            glDeleteProgram(g_ShaderHandleSdf);
+            g_ShaderHandleSdf = 0;
+        }
+    }
+
     // Create buffers
     glGenBuffers(1, &g_VboHandle);
     glGenBuffers(1, &g_ElementsHandle);
@@ -597,6 +945,14 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (g_VboHandle) glDeleteBuffers(1, &g_VboHandle);
     if (g_ElementsHandle) glDeleteBuffers(1, &g_ElementsHandle);
     g_VboHandle = g_ElementsHandle = 0;
+    g_VboSize = g_ElementsSize = 0;
+    g_UploadedLists.clear();
+
+    if (g_ShaderHandleSdf && g_VertHandle) glDetachShader(g_ShaderHandleSdf, g_VertHandle);
+    if (g_ShaderHandleSdf && g_FragHandleSdf) glDetachShader(g_ShaderHandleSdf, g_FragHandleSdf);
+    if (g_FragHandleSdf) glDeleteShader(g_FragHandleSdf);
+    if (g_ShaderHandleSdf) glDeleteProgram(g_ShaderHandleSdf);
+    g_FragHandleSdf = g_ShaderHandleSdf = 0;
 
     if (g_ShaderHandle && g_VertHandle) glDetachShader(g_ShaderHandle, g_VertHandle);
     if (g_VertHandle) glDeleteShader(g_VertHandle);
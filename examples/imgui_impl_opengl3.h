@@ -5,6 +5,9 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Optional persistent vertex/index buffers with sub-range uploads (desktop GL 3.2+). See ImGui_ImplOpenGL3_SetPersistentBuffers().
+//  [X] Renderer: Distance field fonts (ImFontConfig::Sdf), drawn with a second shader program. Requires GL_OES_standard_derivatives on GL ES 2.0.
+//  [X] Renderer: Font texture stored with 1 byte per texel (GL_R8 + texture swizzle) on GL 3.3+ and GL ES 3.0. RGBA32 on older versions.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
@@ -39,6 +42,22 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_NewFrame();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data);
 
+// Persistent buffers: keep one growing vertex/index buffer for the whole ImDrawData instead of reallocating storage for each ImDrawList
+// every frame. Each list is uploaded with glBufferSubData() at its offset and drawn with glDrawElementsBaseVertex().
+// Requires desktop GL 3.2+. Call after ImGui_ImplOpenGL3_Init(). Returns false if the mode is not supported (we keep using the default path).
+// Enabling this also sets ImGuiBackendFlags_RendererUsesContentSignatures, so lists that didn't change since the last frame are not uploaded again.
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_SetPersistentBuffers(bool enabled);
+
+// Statistics for the last call to ImGui_ImplOpenGL3_RenderDrawData()
+struct ImGui_ImplOpenGL3_RenderStats
+{
+    int     BytesUploaded;          // Vertex and index bytes uploaded to the GPU
+    int     BufferReallocations;    // Number of buffer storage (re)allocations (glBufferData calls)
+    int     DrawCalls;
+    int     ListsSkipped;           // Command lists not uploaded because their content signature and offsets were unchanged
+};
+IMGUI_IMPL_API const ImGui_ImplOpenGL3_RenderStats* ImGui_ImplOpenGL3_GetRenderStats();
+
 // Called by Init/NewFrame/Shutdown
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateFontsTexture();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
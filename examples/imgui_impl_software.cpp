@@ -0,0 +1,657 @@
+// dear imgui: Renderer for software rasterization (CPU only, no GPU or graphics API required)
+// This needs to be used along with a Platform Binding (e.g. GLFW, SDL, Win32, custom..), or none at all for headless rendering.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Texture*' as ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Support for ImDrawCallback. Callbacks are called on the thread calling ImGui_ImplSoftware_RenderDrawData(), after all previous commands have been rasterized.
+//  [X] Renderer: Optional multi-threaded rendering, splitting the framebuffer into horizontal bands. See ImGui_ImplSoftware_SetParallelFor().
+
+// You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
+// If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
+// https://github.com/ocornut/imgui
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Reallocate our copy of the font texture when the font atlas grew (ImFontAtlasFlags_Incremental).
+//  2026-10-18: Support for distance field fonts (ImFontConfig::Sdf) with ImGui_ImplSoftware_Texture::DistanceField, used for ImFontAtlas::TexIDSdf.
+//  2026-10-18: Copy the region of the font atlas modified after the texture was created (ImFontAtlas::GetTexDirtyRect()), needed by ImFontAtlasFlags_DynamicGlyphs.
+//  2026-10-18: Initial version.
+
+// Notes about the implementation:
+// - Triangles are rasterized with edge functions evaluated at pixel centers and a top-left fill rule, so that adjacent triangles
+//   sharing an edge never blend the same pixel twice. Edge setup is done in double precision: products of float coordinates
+//   are exact, so shared edges are evaluated identically on both sides.
+// - Most of what dear imgui draws are axis-aligned rectangles (PrimRect/PrimRectUV: backgrounds, frames, text glyphs).
+//   We detect them in the index buffer and fill them directly instead of rasterizing two triangles.
+// - Solid color spans are blended 4 pixels at a time with SSE2 or NEON when available.
+
+#include "imgui.h"
+#include "imgui_impl_software.h"
+#include <string.h>     // memcpy
+#include <math.h>       // floorf, ceilf, ceil, fabsf
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMGUI_IMPL_SOFTWARE_USE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IMGUI_IMPL_SOFTWARE_USE_NEON
+#endif
+
+// Framebuffer being rendered to
+struct ImGui_ImplSoftware_Target
+{
+    ImU32*      Pixels;
+    int         Width;
+    int         Height;
+    int         Pitch;          // In pixels
+};
+
+// Render command with its offsets in the flattened vertex data, and its clipping rectangle in framebuffer pixels
+struct ImGui_ImplSoftware_RenderCmd
+{
+    const ImDrawList*   CmdList;
+    const ImDrawCmd*    Cmd;
+    int                 VtxOffset;      // Offset of CmdList's first vertex in g_VtxPos
+    int                 IdxOffset;      // Offset of Cmd's first index in CmdList->IdxBuffer
+    int                 ClipRect[4];    // x0, y0, x1, y1 (exclusive)
+};
+
+// Arguments for rendering a range of render commands into every band
+struct ImGui_ImplSoftware_RenderBandArgs
+{
+    ImGui_ImplSoftware_Target   Target;
+    int                         CmdBegin;
+    int                         CmdEnd;
+    int                         BandHeight;
+};
+
+// Software renderer data
+static ImGui_ImplSoftware_Texture           g_FontTexture = { NULL, 0, 0, ImGui_ImplSoftware_TextureFormat_Alpha8, false };
+static ImGui_ImplSoftware_Texture           g_FontTextureSdf = { NULL, 0, 0, ImGui_ImplSoftware_TextureFormat_Alpha8, true };    // Same pixels as g_FontTexture, for distance field fonts
+static unsigned char*                       g_FontPixels = NULL;            // Our copy of the font atlas, so the application may call ClearTexData()
+static ImGui_ImplSoftware_ParallelForFunc   g_ParallelFor = NULL;
+static void*                                g_ParallelForUserData = NULL;
+static int                                  g_BandCount = 1;
+static ImVector<ImVec2>                     g_VtxPos;                       // Vertex positions in framebuffer space, for all command lists
+static ImVector<ImGui_ImplSoftware_RenderCmd> g_RenderCmds;
+
+//-----------------------------------------------------------------------------
+// Pixel helpers
+//-----------------------------------------------------------------------------
+
+#define IMGUI_IMPL_SOFTWARE_COL32_RGB_MASK  (~((ImU32)0xFF << IM_COL32_A_SHIFT))
+
+// Exact round(x / 255) for x in [0, 255*255]
+static inline ImU32 ImGui_ImplSoftware_Div255(ImU32 x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Per-channel (src * a + dst * (255 - a)) / 255 on all 4 channels (including alpha), processing 2 channels at a time.
+static inline ImU32 ImGui_ImplSoftware_Blend(ImU32 dst, ImU32 src, ImU32 a)
+{
+    const ImU32 inv_a = 255 - a;
+    ImU32 rb = (src & 0x00FF00FF) * a + (dst & 0x00FF00FF) * inv_a + 0x00800080;
+    ImU32 ag = ((src >> 8) & 0x00FF00FF) * a + ((dst >> 8) & 0x00FF00FF) * inv_a + 0x00800080;
+    rb = ((rb + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    ag = (ag + ((ag >> 8) & 0x00FF00FF)) & 0xFF00FF00;
+    return rb | ag;
+}
+
+static inline void ImGui_ImplSoftware_BlendPixel(ImU32* dst, ImU32 src)
+{
+    const ImU32 a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 255)
+        *dst = src;
+    else if (a != 0)
+        *dst = ImGui_ImplSoftware_Blend(*dst, src, a);
+}
+
+// Per-channel multiplication of a vertex color by a texel
+static inline ImU32 ImGui_ImplSoftware_Modulate(ImU32 col, ImU32 texel)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftware_Div255(((col >> shift) & 0xFF) * ((texel >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+static inline int ImGui_ImplSoftware_TexelCoord(float uv, int size)
+{
+    const int c = (int)(uv * size);
+    return (c < 0) ? 0 : (c >= size) ? size - 1 : c;
+}
+
+static inline ImU32 ImGui_ImplSoftware_FetchTexel(const ImGui_ImplSoftware_Texture* tex, int x, int y)
+{
+    if (tex->Format == ImGui_ImplSoftware_TextureFormat_Alpha8)
+        return IMGUI_IMPL_SOFTWARE_COL32_RGB_MASK | ((ImU32)((const unsigned char*)tex->Pixels)[y * tex->Width + x] << IM_COL32_A_SHIFT);
+    return ((const ImU32*)tex->Pixels)[y * tex->Width + x];
+}
+
+// Alpha channel with bilinear filtering, in [0, 1]
+static float ImGui_ImplSoftware_SampleAlphaBilinear(const ImGui_ImplSoftware_Texture* tex, float u, float v)
+{
+    const float x = u * tex->Width - 0.5f, y = v * tex->Height - 0.5f;
+    const float fx = floorf(x), fy = floorf(y);
+    const float tx = x - fx, ty = y - fy;
+    int x0 = (int)fx, y0 = (int)fy, x1 = x0 + 1, y1 = y0 + 1;
+    x0 = (x0 < 0) ? 0 : (x0 >= tex->Width) ? tex->Width - 1 : x0;
+    x1 = (x1 < 0) ? 0 : (x1 >= tex->Width) ? tex->Width - 1 : x1;
+    y0 = (y0 < 0) ? 0 : (y0 >= tex->Height) ? tex->Height - 1 : y0;
+    y1 = (y1 < 0) ? 0 : (y1 >= tex->Height) ? tex->Height - 1 : y1;
+    const float a00 = (float)((ImGui_ImplSoftware_FetchTexel(tex, x0, y0) >> IM_COL32_A_SHIFT) & 0xFF);
+    const float a10 = (float)((ImGui_ImplSoftware_FetchTexel(tex, x1, y0) >> IM_COL32_A_SHIFT) & 0xFF);
+    const float a01 = (float)((ImGui_ImplSoftware_FetchTexel(tex, x0, y1) >> IM_COL32_A_SHIFT) & 0xFF);
+    const float a11 = (float)((ImGui_ImplSoftware_FetchTexel(tex, x1, y1) >> IM_COL32_A_SHIFT) & 0xFF);
+    const float a0 = a00 + (a10 - a00) * tx;
+    const float a1 = a01 + (a11 - a01) * tx;
+    return (a0 + (a1 - a0) * ty) * (1.0f / 255.0f);
+}
+
+// Distance field texel: same as the fragment shader of the OpenGL3 renderer, where fwidth() is computed from the texture
+// coordinates of the neighbor pixels (the derivatives of u and v along x and y).
+static ImU32 ImGui_ImplSoftware_SampleDistanceField(const ImGui_ImplSoftware_Texture* tex, float u, float v, float du_dx, float dv_dx, float du_dy, float dv_dy)
+{
+    const float d = ImGui_ImplSoftware_SampleAlphaBilinear(tex, u, v);
+    float w = fabsf(ImGui_ImplSoftware_SampleAlphaBilinear(tex, u + du_dx, v + dv_dx) - d) + fabsf(ImGui_ImplSoftware_SampleAlphaBilinear(tex, u + du_dy, v + dv_dy) - d);
+    w = (w > 0.0001f) ? w : 0.0001f;
+    float t = (d - (0.502f - w)) / (2.0f * w);
+    t = (t < 0.0f) ? 0.0f : (t > 1.0f) ? 1.0f : t;
+    t = t * t * (3.0f - 2.0f * t);
+    return IMGUI_IMPL_SOFTWARE_COL32_RGB_MASK | ((ImU32)(t * 255.0f + 0.5f) << IM_COL32_A_SHIFT);
+}
+
+static inline ImU32 ImGui_ImplSoftware_SampleTexture(const ImGui_ImplSoftware_Texture* tex, const ImVec2& uv)
+{
+    if (tex->DistanceField)
+        return ImGui_ImplSoftware_SampleDistanceField(tex, uv.x, uv.y, 0.0f, 0.0f, 0.0f, 0.0f);
+    return ImGui_ImplSoftware_FetchTexel(tex, ImGui_ImplSoftware_TexelCoord(uv.x, tex->Width), ImGui_ImplSoftware_TexelCoord(uv.y, tex->Height));
+}
+
+// Blend a constant color over a span of pixels
+static void ImGui_ImplSoftware_FillSpan(ImU32* dst, int count, ImU32 col)
+{
+    const ImU32 a = (col >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0)
+        return;
+    if (a == 255)
+    {
+        for (int n = 0; n < count; n++)
+            dst[n] = col;
+        return;
+    }
+#if defined(IMGUI_IMPL_SOFTWARE_USE_SSE2)
+    // Same arithmetic as ImGui_ImplSoftware_Blend() with 16-bit lanes: results are bit-identical to the scalar path.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i inv_a = _mm_set1_epi16((short)(255 - a));
+    const __m128i src_a_bias = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)col), zero), _mm_set1_epi16((short)a)), _mm_set1_epi16(128));
+    for (; count >= 4; count -= 4, dst += 4)
+    {
+        const __m128i d = _mm_loadu_si128((const __m128i*)dst);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_a), src_a_bias);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_a), src_a_bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+    }
+#elif defined(IMGUI_IMPL_SOFTWARE_USE_NEON)
+    const uint8x8_t inv_a = vdup_n_u8((uint8_t)(255 - a));
+    const uint16x8_t src_a_bias = vaddq_u16(vmull_u8(vreinterpret_u8_u32(vdup_n_u32(col)), vdup_n_u8((uint8_t)a)), vdupq_n_u16(128));
+    for (; count >= 4; count -= 4, dst += 4)
+    {
+        const uint8x16_t d = vld1q_u8((const uint8_t*)dst);
+        const uint16x8_t lo = vmlal_u8(src_a_bias, vget_low_u8(d), inv_a);
+        const uint16x8_t hi = vmlal_u8(src_a_bias, vget_high_u8(d), inv_a);
+        vst1q_u8((uint8_t*)dst, vcombine_u8(vshrn_n_u16(vaddq_u16(lo, vshrq_n_u16(lo, 8)), 8), vshrn_n_u16(vaddq_u16(hi, vshrq_n_u16(hi, 8)), 8)));
+    }
+#endif
+    for (int n = 0; n < count; n++)
+        dst[n] = ImGui_ImplSoftware_Blend(dst[n], col, a);
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+// Axis-aligned rectangle between corners 'pa' and 'pc', with texture coordinates varying linearly along each axis.
+// A pixel is covered when its center is inside [min, max), which matches the coverage of the 2 triangles it replaces.
+static void ImGui_ImplSoftware_RasterRect(const ImGui_ImplSoftware_Target& target, const int clip[4], const ImVec2& pa, const ImVec2& pc, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col, const ImGui_ImplSoftware_Texture* tex)
+{
+    int x0 = (int)ceilf((pa.x < pc.x ? pa.x : pc.x) - 0.5f);
+    int x1 = (int)ceilf((pa.x < pc.x ? pc.x : pa.x) - 0.5f);
+    int y0 = (int)ceilf((pa.y < pc.y ? pa.y : pc.y) - 0.5f);
+    int y1 = (int)ceilf((pa.y < pc.y ? pc.y : pa.y) - 0.5f);
+    if (x0 < clip[0]) x0 = clip[0];
+    if (y0 < clip[1]) y0 = clip[1];
+    if (x1 > clip[2]) x1 = clip[2];
+    if (y1 > clip[3]) y1 = clip[3];
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    // Solid color, or a single texel (e.g. the white pixel of the font atlas)
+    if (tex == NULL || (uv_a.x == uv_c.x && uv_a.y == uv_c.y))
+    {
+        const ImU32 src = tex ? ImGui_ImplSoftware_Modulate(col, ImGui_ImplSoftware_SampleTexture(tex, uv_a)) : col;
+        for (int y = y0; y < y1; y++)
+            ImGui_ImplSoftware_FillSpan(target.Pixels + y * target.Pitch + x0, x1 - x0, src);
+        return;
+    }
+
+    // Textured (e.g. text glyphs)
+    const float du_dx = (uv_c.x - uv_a.x) / (pc.x - pa.x);
+    const float dv_dy = (uv_c.y - uv_a.y) / (pc.y - pa.y);
+    const float u0 = uv_a.x + (x0 + 0.5f - pa.x) * du_dx;
+    const ImU32 col_rgb = col & IMGUI_IMPL_SOFTWARE_COL32_RGB_MASK;
+    const ImU32 col_a = (col >> IM_COL32_A_SHIFT) & 0xFF;
+    if (tex->DistanceField)
+    {
+        for (int y = y0; y < y1; y++)
+        {
+            ImU32* dst = target.Pixels + y * target.Pitch;
+            const float v = uv_a.y + (y + 0.5f - pa.y) * dv_dy;
+            for (int x = x0; x < x1; x++)
+                ImGui_ImplSoftware_BlendPixel(&dst[x], ImGui_ImplSoftware_Modulate(col, ImGui_ImplSoftware_SampleDistanceField(tex, u0 + (x - x0) * du_dx, v, du_dx, 0.0f, 0.0f, dv_dy)));
+        }
+        return;
+    }
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* dst = target.Pixels + y * target.Pitch;
+        const int ty = ImGui_ImplSoftware_TexelCoord(uv_a.y + (y + 0.5f - pa.y) * dv_dy, tex->Height);
+        if (tex->Format == ImGui_ImplSoftware_TextureFormat_Alpha8)
+        {
+            const unsigned char* texels = (const unsigned char*)tex->Pixels + ty * tex->Width;
+            for (int x = x0; x < x1; x++)
+            {
+                const ImU32 texel = texels[ImGui_ImplSoftware_TexelCoord(u0 + (x - x0) * du_dx, tex->Width)];
+                if (texel == 0)
+                    continue;
+                const ImU32 a = ImGui_ImplSoftware_Div255(col_a * texel);
+                ImGui_ImplSoftware_BlendPixel(&dst[x], col_rgb | (a << IM_COL32_A_SHIFT));
+            }
+        }
+        else
+        {
+            for (int x = x0; x < x1; x++)
+                ImGui_ImplSoftware_BlendPixel(&dst[x], ImGui_ImplSoftware_Modulate(col, ImGui_ImplSoftware_FetchTexel(tex, ImGui_ImplSoftware_TexelCoord(u0 + (x - x0) * du_dx, tex->Width), ty)));
+        }
+    }
+}
+
+static void ImGui_ImplSoftware_RasterTriangle(const ImGui_ImplSoftware_Target& target, const int clip[4], const ImVec2* p[3], const ImDrawVert* v[3], const ImGui_ImplSoftware_Texture* tex)
+{
+    // Edge functions E_i(x, y) = A*x + B*y + C for the edge opposite to vertex i, positive inside the triangle.
+    double A[3], B[3], C[3];
+    for (int i = 0; i < 3; i++)
+    {
+        const ImVec2& pa = *p[(i + 1) % 3];
+        const ImVec2& pb = *p[(i + 2) % 3];
+        A[i] = (double)pa.y - (double)pb.y;
+        B[i] = (double)pb.x - (double)pa.x;
+        C[i] = (double)pa.x * (double)pb.y - (double)pa.y * (double)pb.x;
+    }
+    double area = A[0] * p[0]->x + B[0] * p[0]->y + C[0];
+    if (area == 0.0)
+        return;
+    if (area < 0.0)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            A[i] = -A[i];
+            B[i] = -B[i];
+            C[i] = -C[i];
+        }
+        area = -area;
+    }
+
+    // Bounding box
+    float min_x = p[0]->x, max_x = p[0]->x, min_y = p[0]->y, max_y = p[0]->y;
+    for (int i = 1; i < 3; i++)
+    {
+        min_x = (p[i]->x < min_x) ? p[i]->x : min_x;
+        max_x = (p[i]->x > max_x) ? p[i]->x : max_x;
+        min_y = (p[i]->y < min_y) ? p[i]->y : min_y;
+        max_y = (p[i]->y > max_y) ? p[i]->y : max_y;
+    }
+    const int x0 = ((int)floorf(min_x) > clip[0]) ? (int)floorf(min_x) : clip[0];
+    const int x1 = ((int)ceilf(max_x) < clip[2]) ? (int)ceilf(max_x) : clip[2];
+    const int y0 = ((int)floorf(min_y) > clip[1]) ? (int)floorf(min_y) : clip[1];
+    const int y1 = ((int)ceilf(max_y) < clip[3]) ? (int)ceilf(max_y) : clip[3];
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    // Attributes: solid color and single texel triangles (most of them) are filled with a constant color
+    const bool uniform_col = (v[0]->col == v[1]->col && v[0]->col == v[2]->col);
+    const bool uniform_uv = (tex == NULL) || (v[0]->uv.x == v[1]->uv.x && v[0]->uv.x == v[2]->uv.x && v[0]->uv.y == v[1]->uv.y && v[0]->uv.y == v[2]->uv.y);
+    const ImU32 uniform_texel = (tex != NULL && uniform_uv) ? ImGui_ImplSoftware_SampleTexture(tex, v[0]->uv) : 0xFFFFFFFF;
+    ImU32 uniform_src = 0;
+    if (uniform_col)
+        uniform_src = (tex != NULL) ? ImGui_ImplSoftware_Modulate(v[0]->col, uniform_texel) : v[0]->col;
+
+    // Otherwise interpolate r, g, b, a, u, v with planes: attr(x, y) = dx * x + dy * y + c
+    enum { Attr_R, Attr_G, Attr_B, Attr_A, Attr_U, Attr_V, Attr_COUNT };
+    static const int shifts[4] = { IM_COL32_R_SHIFT, IM_COL32_G_SHIFT, IM_COL32_B_SHIFT, IM_COL32_A_SHIFT };
+    float attr_dx[Attr_COUNT], attr_dy[Attr_COUNT], attr_c[Attr_COUNT];
+    if (!uniform_col || !uniform_uv)
+    {
+        const double inv_area = 1.0 / area;
+        for (int attr = 0; attr < Attr_COUNT; attr++)
+        {
+            double values[3];
+            for (int i = 0; i < 3; i++)
+                values[i] = (attr < Attr_U) ? (double)((v[i]->col >> shifts[attr]) & 0xFF) : (attr == Attr_U) ? (double)v[i]->uv.x : (double)v[i]->uv.y;
+            attr_dx[attr] = (float)((A[0] * values[0] + A[1] * values[1] + A[2] * values[2]) * inv_area);
+            attr_dy[attr] = (float)((B[0] * values[0] + B[1] * values[1] + B[2] * values[2]) * inv_area);
+            attr_c[attr] = (float)((C[0] * values[0] + C[1] * values[1] + C[2] * values[2]) * inv_area);
+        }
+    }
+
+    for (int y = y0; y < y1; y++)
+    {
+        // Find the span of pixel centers inside all 3 edges on this row.
+        // Top-left rule: pixel centers exactly on an edge are covered when the edge is a left edge (A > 0) or a top edge (A == 0, B > 0).
+        const double yc = y + 0.5;
+        int xs = x0, xe = x1;
+        for (int i = 0; i < 3 && xs < xe; i++)
+        {
+            const double e = B[i] * yc + C[i];
+            if (A[i] == 0.0)
+            {
+                if (B[i] > 0.0 ? (e < 0.0) : (e <= 0.0))
+                    xe = xs;
+                continue;
+            }
+            double t = -e / A[i] - 0.5; // E_i(t + 0.5, yc) == 0
+            t = (t < x0 - 1) ? x0 - 1 : (t > x1 + 1) ? x1 + 1 : t;
+            const int bound = (int)ceil(t);
+            if (A[i] > 0.0 && bound > xs)
+                xs = bound;             // x >= t
+            else if (A[i] < 0.0 && bound < xe)
+                xe = bound;             // x < t
+        }
+        if (xs >= xe)
+            continue;
+
+        ImU32* dst = target.Pixels + y * target.Pitch;
+        if (uniform_col && uniform_uv)
+        {
+            ImGui_ImplSoftware_FillSpan(dst + xs, xe - xs, uniform_src);
+            continue;
+        }
+        for (int x = xs; x < xe; x++)
+        {
+            const float xc = x + 0.5f, ycf = (float)yc;
+            ImU32 col = v[0]->col;
+            if (!uniform_col)
+            {
+                col = 0;
+                for (int attr = Attr_R; attr <= Attr_A; attr++)
+                {
+                    int c = (int)(attr_dx[attr] * xc + attr_dy[attr] * ycf + attr_c[attr] + 0.5f);
+                    c = (c < 0) ? 0 : (c > 255) ? 255 : c;
+                    col |= (ImU32)c << shifts[attr];
+                }
+            }
+            ImU32 src = col;
+            if (tex != NULL)
+            {
+                ImU32 texel = uniform_texel;
+                if (!uniform_uv)
+                {
+                    const float tex_u = attr_dx[Attr_U] * xc + attr_dy[Attr_U] * ycf + attr_c[Attr_U];
+                    const float tex_v = attr_dx[Attr_V] * xc + attr_dy[Attr_V] * ycf + attr_c[Attr_V];
+                    if (tex->DistanceField)
+                        texel = ImGui_ImplSoftware_SampleDistanceField(tex, tex_u, tex_v, attr_dx[Attr_U], attr_dx[Attr_V], attr_dy[Attr_U], attr_dy[Attr_V]);
+                    else
+                        texel = ImGui_ImplSoftware_SampleTexture(tex, ImVec2(tex_u, tex_v));
+                }
+                src = ImGui_ImplSoftware_Modulate(col, texel);
+            }
+            ImGui_ImplSoftware_BlendPixel(&dst[x], src);
+        }
+    }
+}
+
+// Render a range of commands into one band of the framebuffer
+static void ImGui_ImplSoftware_RenderBand(int band_index, void* arg)
+{
+    const ImGui_ImplSoftware_RenderBandArgs* args = (const ImGui_ImplSoftware_RenderBandArgs*)arg;
+    const int band_y0 = band_index * args->BandHeight;
+    const int band_y1 = (band_y0 + args->BandHeight < args->Target.Height) ? band_y0 + args->BandHeight : args->Target.Height;
+    for (int cmd_n = args->CmdBegin; cmd_n < args->CmdEnd; cmd_n++)
+    {
+        const ImGui_ImplSoftware_RenderCmd& render_cmd = g_RenderCmds[cmd_n];
+        int clip[4] = { render_cmd.ClipRect[0], render_cmd.ClipRect[1], render_cmd.ClipRect[2], render_cmd.ClipRect[3] };
+        clip[1] = (clip[1] > band_y0) ? clip[1] : band_y0;
+        clip[3] = (clip[3] < band_y1) ? clip[3] : band_y1;
+        if (clip[0] >= clip[2] || clip[1] >= clip[3])
+            continue;
+
+        const ImDrawVert* vtx_buffer = render_cmd.CmdList->VtxBuffer.Data;
+        const ImVec2* pos_buffer = g_VtxPos.Data + render_cmd.VtxOffset;
+        const ImDrawIdx* idx_buffer = render_cmd.CmdList->IdxBuffer.Data + render_cmd.IdxOffset;
+        const ImGui_ImplSoftware_Texture* tex = (const ImGui_ImplSoftware_Texture*)render_cmd.Cmd->TextureId;
+        const int elem_count = (int)render_cmd.Cmd->ElemCount;
+        for (int i = 0; i + 3 <= elem_count; )
+        {
+            // Axis-aligned rectangle emitted by PrimRect()/PrimRectUV() as triangles (a, b, c) + (a, c, d)
+            if (i + 6 <= elem_count && idx_buffer[i + 3] == idx_buffer[i] && idx_buffer[i + 4] == idx_buffer[i + 2])
+            {
+                const ImDrawIdx ia = idx_buffer[i], ib = idx_buffer[i + 1], ic = idx_buffer[i + 2], id = idx_buffer[i + 5];
+                const ImVec2& pa = pos_buffer[ia], &pb = pos_buffer[ib], &pc = pos_buffer[ic], &pd = pos_buffer[id];
+                const ImDrawVert& va = vtx_buffer[ia], &vb = vtx_buffer[ib], &vc = vtx_buffer[ic], &vd = vtx_buffer[id];
+                if (pa.y == pb.y && pb.x == pc.x && pc.y == pd.y && pd.x == pa.x &&
+                    va.uv.y == vb.uv.y && vb.uv.x == vc.uv.x && vc.uv.y == vd.uv.y && vd.uv.x == va.uv.x &&
+                    va.col == vb.col && va.col == vc.col && va.col == vd.col)
+                {
+                    ImGui_ImplSoftware_RasterRect(args->Target, clip, pa, pc, va.uv, vc.uv, va.col, tex);
+                    i += 6;
+                    continue;
+                }
+            }
+
+            const ImVec2* p[3] = { &pos_buffer[idx_buffer[i]], &pos_buffer[idx_buffer[i + 1]], &pos_buffer[idx_buffer[i + 2]] };
+            const ImDrawVert* v[3] = { &vtx_buffer[idx_buffer[i]], &vtx_buffer[idx_buffer[i + 1]], &vtx_buffer[idx_buffer[i + 2]] };
+            ImGui_ImplSoftware_RasterTriangle(args->Target, clip, p, v, tex);
+            i += 3;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplSoftware_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_software";
+    return true;
+}
+
+void    ImGui_ImplSoftware_Shutdown()
+{
+    ImGui_ImplSoftware_DestroyFontsTexture();
+    g_VtxPos.clear();
+    g_RenderCmds.clear();
+}
+
+void    ImGui_ImplSoftware_NewFrame()
+{
+    if (!g_FontPixels)
+        ImGui_ImplSoftware_CreateFontsTexture();
+}
+
+void    ImGui_ImplSoftware_SetParallelFor(ImGui_ImplSoftware_ParallelForFunc parallel_for, void* user_data, int band_count)
+{
+    g_ParallelFor = parallel_for;
+    g_ParallelForUserData = user_data;
+    g_BandCount = (parallel_for != NULL && band_count > 1) ? band_count : 1;
+}
+
+// Copy the region of the atlas modified since our copy was made (e.g. glyphs rasterized on demand with ImFontAtlasFlags_DynamicGlyphs)
+// If fonts were added with ImFontAtlasFlags_Incremental, the atlas may have grown: the dirty region then covers the whole texture.
+static void ImGui_ImplSoftware_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    int x, y, w, h;
+    if (!g_FontPixels || !io.Fonts->GetTexDirtyRect(&x, &y, &w, &h))
+        return;
+    unsigned char* pixels;
+    int width, height, bytes_per_pixel;
+    if (g_FontTexture.Format == ImGui_ImplSoftware_TextureFormat_RGBA32)
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);
+    else
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+    if (width != g_FontTexture.Width || height != g_FontTexture.Height)
+    {
+        IM_FREE(g_FontPixels);
+        g_FontPixels = (unsigned char*)IM_ALLOC((size_t)width * (size_t)height * (size_t)bytes_per_pixel);
+        g_FontTexture.Pixels = g_FontTextureSdf.Pixels = g_FontPixels;
+        g_FontTexture.Width = g_FontTextureSdf.Width = width;
+        g_FontTexture.Height = g_FontTextureSdf.Height = height;
+    }
+    for (int row = y; row < y + h; row++)
+    {
+        const size_t offset = ((size_t)row * width + x) * bytes_per_pixel;
+        memcpy(g_FontPixels + offset, pixels + offset, (size_t)w * bytes_per_pixel);
+    }
+    io.Fonts->ClearTexDirtyRect();
+}
+
+// Software Render function.
+// The framebuffer is not cleared. 'pixels' points to the top-left pixel, 'pitch_in_bytes' is the distance between 2 rows.
+void    ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int pitch_in_bytes)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    fb_width = (fb_width < width) ? fb_width : width;
+    fb_height = (fb_height < height) ? fb_height : height;
+    if (fb_width <= 0 || fb_height <= 0 || pixels == NULL)
+        return;
+    IM_ASSERT(pitch_in_bytes >= width * (int)sizeof(ImU32) && (pitch_in_bytes % sizeof(ImU32)) == 0);
+    ImGui_ImplSoftware_UpdateFontsTexture();
+
+    ImGui_ImplSoftware_RenderBandArgs args;
+    args.Target.Pixels = (ImU32*)pixels;
+    args.Target.Width = fb_width;
+    args.Target.Height = fb_height;
+    args.Target.Pitch = pitch_in_bytes / (int)sizeof(ImU32);
+
+    // Project vertices and clipping rectangles into framebuffer space once, they are shared by all bands
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    g_VtxPos.resize(draw_data->TotalVtxCount);
+    g_RenderCmds.resize(0);
+    int global_vtx_offset = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        ImVec2* pos_dst = g_VtxPos.Data + global_vtx_offset;
+        for (int vtx_i = 0; vtx_i < cmd_list->VtxBuffer.Size; vtx_i++)
+            pos_dst[vtx_i] = ImVec2((cmd_list->VtxBuffer.Data[vtx_i].pos.x - clip_off.x) * clip_scale.x, (cmd_list->VtxBuffer.Data[vtx_i].pos.y - clip_off.y) * clip_scale.y);
+
+        int idx_offset = 0;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            ImGui_ImplSoftware_RenderCmd render_cmd;
+            render_cmd.CmdList = cmd_list;
+            render_cmd.Cmd = pcmd;
+            render_cmd.VtxOffset = global_vtx_offset;
+            render_cmd.IdxOffset = idx_offset;
+
+            // Pixels are clipped when their center is outside the clipping rectangle (same as scissoring for integer coordinates)
+            const float clip_x0 = (pcmd->ClipRect.x - clip_off.x) * clip_scale.x;
+            const float clip_y0 = (pcmd->ClipRect.y - clip_off.y) * clip_scale.y;
+            const float clip_x1 = (pcmd->ClipRect.z - clip_off.x) * clip_scale.x;
+            const float clip_y1 = (pcmd->ClipRect.w - clip_off.y) * clip_scale.y;
+            render_cmd.ClipRect[0] = (clip_x0 > 0.0f) ? (int)ceilf(clip_x0 - 0.5f) : 0;
+            render_cmd.ClipRect[1] = (clip_y0 > 0.0f) ? (int)ceilf(clip_y0 - 0.5f) : 0;
+            render_cmd.ClipRect[2] = (clip_x1 < (float)fb_width) ? (int)ceilf(clip_x1 - 0.5f) : fb_width;
+            render_cmd.ClipRect[3] = (clip_y1 < (float)fb_height) ? (int)ceilf(clip_y1 - 0.5f) : fb_height;
+            g_RenderCmds.push_back(render_cmd);
+            idx_offset += pcmd->ElemCount;
+        }
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+    }
+
+    // Rasterize ranges of commands between user callbacks, which are called on this thread
+    const int band_count = (g_BandCount < fb_height) ? g_BandCount : fb_height;
+    args.BandHeight = (fb_height + band_count - 1) / band_count;
+    const int band_count_used = (fb_height + args.BandHeight - 1) / args.BandHeight;
+    int range_begin = 0;
+    for (int cmd_n = 0; cmd_n <= g_RenderCmds.Size; cmd_n++)
+    {
+        const ImGui_ImplSoftware_RenderCmd* render_cmd = (cmd_n < g_RenderCmds.Size) ? &g_RenderCmds[cmd_n] : NULL;
+        if (render_cmd != NULL && render_cmd->Cmd->UserCallback == NULL)
+            continue;
+        if (range_begin < cmd_n)
+        {
+            args.CmdBegin = range_begin;
+            args.CmdEnd = cmd_n;
+            if (band_count_used > 1)
+                g_ParallelFor(band_count_used, ImGui_ImplSoftware_RenderBand, &args, g_ParallelForUserData);
+            else
+                ImGui_ImplSoftware_RenderBand(0, &args);
+        }
+        range_begin = cmd_n + 1;
+
+        // User callback, registered via ImDrawList::AddCallback()
+        // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state. We don't have any.)
+        if (render_cmd != NULL && render_cmd->Cmd->UserCallback != ImDrawCallback_ResetRenderState)
+            render_cmd->Cmd->UserCallback(render_cmd->CmdList, render_cmd->Cmd);
+    }
+}
+
+bool    ImGui_ImplSoftware_CreateFontsTexture()
+{
+    // Build texture atlas
+    // Use the 1 byte per texel texture unless the application already requested RGBA32 data (e.g. to store colored custom rectangles).
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height, bytes_per_pixel;
+    if (io.Fonts->TexPixelsRGBA32 != NULL)
+    {
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);
+        g_FontTexture.Format = ImGui_ImplSoftware_TextureFormat_RGBA32;
+    }
+    else
+    {
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+        g_FontTexture.Format = ImGui_ImplSoftware_TextureFormat_Alpha8;
+    }
+
+    // Keep our own copy of the texture
+    const size_t size = (size_t)width * (size_t)height * (size_t)bytes_per_pixel;
+    g_FontPixels = (unsigned char*)IM_ALLOC(size);
+    memcpy(g_FontPixels, pixels, size);
+    g_FontTexture.Pixels = g_FontPixels;
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+    g_FontTextureSdf.Pixels = g_FontPixels;
+    g_FontTextureSdf.Width = width;
+    g_FontTextureSdf.Height = height;
+    g_FontTextureSdf.Format = g_FontTexture.Format;
+
+    // Store our identifiers
+    io.Fonts->TexID = (ImTextureID)&g_FontTexture;
+    io.Fonts->TexIDSdf = (ImTextureID)&g_FontTextureSdf;
+    io.Fonts->ClearTexDirtyRect();
+    return true;
+}
+
+void    ImGui_ImplSoftware_DestroyFontsTexture()
+{
+    if (g_FontPixels)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        IM_FREE(g_FontPixels);
+        g_FontPixels = NULL;
+        g_FontTexture.Pixels = g_FontTextureSdf.Pixels = NULL;
+        io.Fonts->TexID = io.Fonts->TexIDSdf = 0;
+    }
+}
@@ -0,0 +1,52 @@
+// dear imgui: Renderer for software rasterization (CPU only, no GPU or graphics API required)
+// This needs to be used along with a Platform Binding (e.g. GLFW, SDL, Win32, custom..), or none at all for headless rendering.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Texture*' as ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Support for ImDrawCallback. Callbacks are called on the thread calling ImGui_ImplSoftware_RenderDrawData(), after all previous commands have been rasterized.
+//  [X] Renderer: Optional multi-threaded rendering, splitting the framebuffer into horizontal bands. See ImGui_ImplSoftware_SetParallelFor().
+//  [X] Renderer: Distance field fonts (ImFontConfig::Sdf), matching the shader of the OpenGL3 renderer. Can be used as a CPU reference.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
+// If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
+// https://github.com/ocornut/imgui
+
+// The framebuffer is provided by the caller on each call to ImGui_ImplSoftware_RenderDrawData(). Pixels are 32-bit colors
+// packed the same way as ImU32/IM_COL32() colors (RGBA in memory order by default, see IMGUI_USE_BGRA_PACKED_COLOR).
+// Blending matches the other renderers (glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) applied to all 4 channels).
+// Textures are sampled with nearest filtering, which is exact for text and most of what dear imgui draws.
+// Distance field textures are sampled with bilinear filtering, then thresholded with antialiasing over the footprint of the pixel.
+
+#pragma once
+
+enum ImGui_ImplSoftware_TextureFormat
+{
+    ImGui_ImplSoftware_TextureFormat_Alpha8,        // 1 byte per texel, color is white
+    ImGui_ImplSoftware_TextureFormat_RGBA32         // 4 bytes per texel, packed like ImU32 colors
+};
+
+// A texture that can be used as ImTextureID. Pixels are not copied and must stay valid while used for rendering.
+struct ImGui_ImplSoftware_Texture
+{
+    const void*                         Pixels;
+    int                                 Width;
+    int                                 Height;
+    ImGui_ImplSoftware_TextureFormat    Format;
+    bool                                DistanceField;  // Alpha is a signed distance, 128 on the outline (ImFontConfig::Sdf). We use this for ImFontAtlas::TexIDSdf.
+};
+
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_Init();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int pitch_in_bytes);
+
+// Multi-threading: the framebuffer is split in 'band_count' horizontal bands which are rasterized independently.
+// Your 'parallel_for' function must call func(index, func_arg) for every index in [0, count), possibly on multiple threads,
+// and return only once they have all completed. Output is identical regardless of the number of bands.
+// Pass NULL to render on the calling thread (default).
+typedef void    (*ImGui_ImplSoftware_ParallelForFunc)(int count, void (*func)(int index, void* func_arg), void* func_arg, void* user_data);
+IMGUI_IMPL_API void     ImGui_ImplSoftware_SetParallelFor(ImGui_ImplSoftware_ParallelForFunc parallel_for, void* user_data, int band_count);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_DestroyFontsTexture();
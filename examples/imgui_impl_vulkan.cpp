@@ -20,6 +20,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Vulkan: Font image uses VK_FORMAT_R8_UNORM with a component mapping, so the font atlas is never converted to RGBA32 unless the application requested it.
+//  2026-10-18: Vulkan: Skip copying command lists whose ImDrawList::ContentSignature and buffer offsets are unchanged since the last time the same frame buffers were used (sets ImGuiBackendFlags_RendererUsesContentSignatures).
 //  2019-04-30: Vulkan: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-04-04: *BREAKING CHANGE*: Vulkan: Added ImageCount/MinImageCount fields in ImGui_ImplVulkan_InitInfo, required for initialization (was previously a hard #define IMGUI_VK_QUEUED_FRAMES 2). Added ImGui_ImplVulkan_SetMinImageCount().
 //  2019-04-04: Vulkan: Added VkInstance argument to ImGui_ImplVulkanH_CreateWindow() optional helper.
@@ -44,6 +46,14 @@
 #include "imgui_impl_vulkan.h"
 #include <stdio.h>
 
+// Content of the vertex/index buffers for one command list index, as uploaded the last time the buffers were used
+struct ImGui_ImplVulkanH_UploadedList
+{
+    ImU64               Signature;      // ImDrawList::ContentSignature (0: unknown)
+    VkDeviceSize        VtxOffset;
+    VkDeviceSize        IdxOffset;
+};
+
 // Reusable buffers used for rendering 1 current in-flight frame, for ImGui_ImplVulkan_RenderDrawData()
 // [Please zero-clear before use!]
 struct ImGui_ImplVulkanH_FrameRenderBuffers
@@ -54,6 +64,9 @@ struct ImGui_ImplVulkanH_FrameRenderBuffers
     VkDeviceSize        IndexBufferSize;
     VkBuffer            VertexBuffer;
     VkBuffer            IndexBuffer;
+    ImGui_ImplVulkanH_UploadedList* UploadedLists;
+    int                 UploadedListsCount;
+    int                 UploadedListsCapacity;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -334,11 +347,30 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     size_t vertex_size = draw_data->TotalVtxCount * sizeof(ImDrawVert);
     size_t index_size = draw_data->TotalIdxCount * sizeof(ImDrawIdx);
     if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
+    {
         CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+        rb->UploadedListsCount = 0;
+    }
     if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
+    {
         CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+        rb->UploadedListsCount = 0;
+    }
+    if (rb->UploadedListsCapacity < draw_data->CmdListsCount)
+    {
+        ImGui_ImplVulkanH_UploadedList* new_lists = (ImGui_ImplVulkanH_UploadedList*)IM_ALLOC(sizeof(ImGui_ImplVulkanH_UploadedList) * draw_data->CmdListsCount);
+        if (rb->UploadedLists)
+        {
+            memcpy(new_lists, rb->UploadedLists, sizeof(ImGui_ImplVulkanH_UploadedList) * rb->UploadedListsCount);
+            IM_FREE(rb->UploadedLists);
+        }
+        rb->UploadedLists = new_lists;
+        rb->UploadedListsCapacity = draw_data->CmdListsCount;
+    }
 
     // Upload vertex/index data into a single contiguous GPU buffer
+    // The memory is host visible and keeps its contents, so command lists that are unchanged since the last time
+    // this frame's buffers were used (same content signature at the same offsets) don't need to be copied again.
     {
         ImDrawVert* vtx_dst = NULL;
         ImDrawIdx* idx_dst = NULL;
@@ -346,14 +378,33 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         check_vk_result(err);
         err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, index_size, 0, (void**)(&idx_dst));
         check_vk_result(err);
+        const int prev_uploaded_count = rb->UploadedListsCount;
+        VkDeviceSize vtx_offset = 0;
+        VkDeviceSize idx_offset = 0;
+        int lists_skipped = 0;
         for (int n = 0; n < draw_data->CmdListsCount; n++)
         {
             const ImDrawList* cmd_list = draw_data->CmdLists[n];
-            memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
-            memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            ImGui_ImplVulkanH_UploadedList* uploaded = &rb->UploadedLists[n];
+            if (n < prev_uploaded_count && cmd_list->ContentSignature != 0 && uploaded->Signature == cmd_list->ContentSignature && uploaded->VtxOffset == vtx_offset && uploaded->IdxOffset == idx_offset)
+            {
+                lists_skipped++;
+            }
+            else
+            {
+                memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+                memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+                uploaded->Signature = cmd_list->ContentSignature;
+                uploaded->VtxOffset = vtx_offset;
+                uploaded->IdxOffset = idx_offset;
+            }
             vtx_dst += cmd_list->VtxBuffer.Size;
             idx_dst += cmd_list->IdxBuffer.Size;
+            vtx_offset += cmd_list->VtxBuffer.Size;
+            idx_offset += cmd_list->IdxBuffer.Size;
         }
+        rb->UploadedListsCount = draw_data->CmdListsCount;
+        ImGui::GetIO().MetricsRenderListsSkipped = lists_skipped;
         VkMappedMemoryRange range[2] = {};
         range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
         range[0].memory = rb->VertexBufferMemory;
@@ -432,10 +483,17 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
     ImGui_ImplVulkan_InitInfo* v = &g_VulkanInitInfo;
     ImGuiIO& io = ImGui::GetIO();
 
+    // Use a 1 byte per texel image, with a component mapping returning (1,1,1,R) to the shader, so the atlas is never converted to RGBA32.
+    // Use RGBA32 if the application already requested RGBA32 data (e.g. to store colored custom rectangles).
+    const bool alpha8 = (io.Fonts->TexPixelsRGBA32 == NULL);
+    const VkFormat format = alpha8 ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
     unsigned char* pixels;
-    int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
-    size_t upload_size = width*height*4*sizeof(char);
+    int width, height, bytes_per_pixel;
+    if (alpha8)
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+    else
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);
+    size_t upload_size = width*height*bytes_per_pixel*sizeof(char);
 
     VkResult err;
 
@@ -444,7 +502,7 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
         VkImageCreateInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         info.imageType = VK_IMAGE_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
         info.extent.width = width;
         info.extent.height = height;
         info.extent.depth = 1;
@@ -475,7 +533,14 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
         info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         info.image = g_FontImage;
         info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
+        if (alpha8)
+        {
+            info.components.r = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.g = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.b = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.a = VK_COMPONENT_SWIZZLE_R;
+        }
         info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         info.subresourceRange.levelCount = 1;
         info.subresourceRange.layerCount = 1;
@@ -801,6 +866,7 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
 {
     ImGuiIO& io = ImGui::GetIO();
     io.BackendRendererName = "imgui_impl_vulkan";
+    io.BackendFlags |= ImGuiBackendFlags_RendererUsesContentSignatures;  // We can skip copying unchanged command lists to our (persistently allocated) frame buffers.
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -821,6 +887,7 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
 void ImGui_ImplVulkan_Shutdown()
 {
     ImGui_ImplVulkan_DestroyDeviceObjects();
+    ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererUsesContentSignatures;
 }
 
 void ImGui_ImplVulkan_NewFrame()
@@ -1199,6 +1266,9 @@ void ImGui_ImplVulkanH_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulk
     if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
     buffers->VertexBufferSize = 0;
     buffers->IndexBufferSize = 0;
+    IM_FREE(buffers->UploadedLists);
+    buffers->UploadedLists = NULL;
+    buffers->UploadedListsCount = buffers->UploadedListsCapacity = 0;
 }
 
 void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkanH_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
@@ -61,6 +61,18 @@
         operator MyVec4() const { return MyVec4(x,y,z,w); }
 */
 
+//---- Select a faster hash function for ImGuiID (ImHashStr/ImHashData). Default is a byte-at-a-time CRC32 using a 1KB lookup table.
+// Hash values differ between options, make sure all your code hardcoding or persisting ImGuiID values is built with the same setting.
+//#define IMGUI_USE_MURMUR3_HASH                            // Portable word-at-a-time MurmurHash3, no lookup table.
+//#define IMGUI_USE_CRC32C_HASH                             // Hardware CRC32C, requires SSE4.2 (e.g. -msse4.2 or /arch:AVX) or ARMv8 CRC32 (e.g. -march=armv8-a+crc).
+
+//---- Use a flat open-addressing hash table for ImGuiStorage (window state storage, tree node open state, windows by ID) instead of a sorted array.
+// Insertion and lookup become O(1) instead of O(N) and O(log N). Recommended with very large amounts of tree nodes or stored state.
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Don't use SSE2/NEON intrinsics (currently used to tessellate anti-aliased polylines and to measure ASCII text). The scalar code paths produce the same results.
+//#define IMGUI_DISABLE_SIMD
+
 //---- Use 32-bit vertex indices (default is 16-bit) to allow meshes with more than 64K vertices. Render function needs to support it.
 //#define ImDrawIdx unsigned int
 
@@ -69,6 +69,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
+// [SECTION] ImGuiTextLog
 // [SECTION] ImGuiListClipper
 // [SECTION] RENDER HELPERS
 // [SECTION] MAIN CODE (most of the code! lots of stuff, needs tidying up!)
@@ -1038,6 +1039,7 @@ static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduc
 
 static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
+static void             UpdateWindowInSpatialIndex(ImGuiWindow* window);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImVec2 size, ImGuiWindowFlags flags);
 static void             CheckStacksSize(ImGuiWindow* window, bool write);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window, bool snap_on_edges);
@@ -1077,6 +1079,10 @@ static int              FindWindowFocusIndex(ImGuiWindow* window);
 // Misc
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
+static void             UpdateTextSizeCache();
+static ImGuiTextSizeCacheEntry* FindTextSizeCacheEntry(const ImFont* font, float font_size, float wrap_width, const char* text, int text_len, ImU64* out_hash);
+static void             AddTextCached(ImDrawList* draw_list, const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text, const char* text_end, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
+static void             UpdateTextLineIndices();
 static void             UpdateManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4]);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1159,6 +1165,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines        = true;             // Enable anti-aliasing on lines/borders. Disable if you are really short on CPU/GPU.
     AntiAliasedFill         = true;             // Enable anti-aliasing on filled shapes (rounded rectangles, circles, etc.)
     CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
+    CircleSegmentMaxError   = 0.30f;            // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() without a specific number of segments. Decrease for highly tessellated circles (higher quality, more polygons), increase to reduce quality.
 
     // Default theme
     ImGui::StyleColorsDark(this);
@@ -1227,6 +1234,9 @@ ImGuiIO::ImGuiIO()
     ConfigInputTextCursorBlink = true;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
+    ConfigTextSizeCache = false;
+    ConfigTextLineIndex = false;
+    ConfigWindowsSpatialIndex = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1487,6 +1497,89 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_FORMAT_STRING_FUNCTIONS
 
+// The hash function used for ImGuiID may be selected in imconfig.h:
+// - Default:                  CRC32 using a 1KB lookup table, one byte at a time.
+// - IMGUI_USE_MURMUR3_HASH:   MurmurHash3 (x86_32 variant), four bytes at a time, no lookup table.
+// - IMGUI_USE_CRC32C_HASH:    CRC32C using the SSE4.2 or ARMv8 CRC32 instructions, eight bytes at a time.
+// All variants honor the "###" operator (see ImHashStr). Hash values differ between variants, so all code that
+// hardcodes or persists ImGuiID values must be compiled with the same setting.
+#if defined(IMGUI_USE_MURMUR3_HASH) && defined(IMGUI_USE_CRC32C_HASH)
+#error "IMGUI_USE_MURMUR3_HASH and IMGUI_USE_CRC32C_HASH are mutually exclusive."
+#endif
+
+#if defined(IMGUI_USE_MURMUR3_HASH)
+
+static inline ImU32 ImRotl32(ImU32 v, int r) { return (v << r) | (v >> (32 - r)); }
+
+static ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    const ImU32 c1 = 0xCC9E2D51;
+    const ImU32 c2 = 0x1B873593;
+    ImU32 h = seed;
+    const unsigned char* data_end_words = data + (data_size & ~(size_t)3);
+    for (; data != data_end_words; data += 4)
+    {
+        ImU32 k;
+        memcpy(&k, data, 4);
+        k = ImRotl32(k * c1, 15) * c2;
+        h = ImRotl32(h ^ k, 13) * 5 + 0xE6546B64;
+    }
+    ImU32 k = 0;
+    switch (data_size & 3)
+    {
+    case 3: k ^= (ImU32)data[2] << 16; // Fallthrough
+    case 2: k ^= (ImU32)data[1] << 8;  // Fallthrough
+    case 1: k ^= (ImU32)data[0]; h ^= ImRotl32(k * c1, 15) * c2;
+    }
+    h ^= (ImU32)data_size;
+    h ^= h >> 16; h *= 0x85EBCA6B;
+    h ^= h >> 13; h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
+#elif defined(IMGUI_USE_CRC32C_HASH)
+
+#if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+#include <nmmintrin.h>
+#if defined(_M_X64) || defined(__x86_64__)
+#define IM_CRC32C_U64(crc, v)   (ImU32)_mm_crc32_u64((crc), (v))
+#endif
+#define IM_CRC32C_U32(crc, v)   _mm_crc32_u32((crc), (v))
+#define IM_CRC32C_U8(crc, v)    _mm_crc32_u8((crc), (v))
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define IM_CRC32C_U64(crc, v)   __crc32cd((crc), (v))
+#define IM_CRC32C_U32(crc, v)   __crc32cw((crc), (v))
+#define IM_CRC32C_U8(crc, v)    __crc32cb((crc), (v))
+#else
+#error "IMGUI_USE_CRC32C_HASH requires SSE4.2 (e.g. -msse4.2 or /arch:AVX) or ARMv8 CRC32 (e.g. -march=armv8-a+crc) to be enabled."
+#endif
+
+static ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = ~seed;
+#ifdef IM_CRC32C_U64
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = IM_CRC32C_U64(crc, v);
+    }
+#endif
+    for (; data_size >= 4; data += 4, data_size -= 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = IM_CRC32C_U32(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = IM_CRC32C_U8(crc, *data++);
+    return ~crc;
+}
+
+#else
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1510,17 +1603,22 @@ static const ImU32 GCrc32LookupTable[256] =
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
 
+#endif // #if defined(IMGUI_USE_MURMUR3_HASH)
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
+#if defined(IMGUI_USE_MURMUR3_HASH) || defined(IMGUI_USE_CRC32C_HASH)
+    return ImHashBytes((const unsigned char*)data_p, data_size, seed);
+#else
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
     return ~crc;
+#endif
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
@@ -1528,9 +1626,19 @@ ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - The word-at-a-time variants can't reset in the middle of a word, so they first locate the last ### (using memchr()
+//   which is vectorized by most C libraries) and hash from there, which is equivalent.
 ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
+#if defined(IMGUI_USE_MURMUR3_HASH) || defined(IMGUI_USE_CRC32C_HASH)
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    for (const char* p = data_p; data_end - p >= 3 && (p = (const char*)memchr(p, '#', (size_t)(data_end - p - 2))) != NULL; p++)
+        if (p[1] == '#' && p[2] == '#')
+            data_p = p;
+    return ImHashBytes((const unsigned char*)data_p, (size_t)(data_end - data_p), seed);
+#else
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
@@ -1555,6 +1663,7 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
         }
     }
     return ~crc;
+#endif
 }
 
 FILE* ImFileOpen(const char* filename, const char* mode)
@@ -1911,6 +2020,165 @@ ImU32 ImGui::GetColorU32(ImU32 col)
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+
+// Flat open-addressing hash table with linear probing. Keys are never removed so we don't need tombstones.
+// Slots with key 0 are unused, the value for key 0 is stored in an extra slot at Data[HashCapacity].
+static inline int StorageHashSlot(ImGuiID key, int capacity)
+{
+    ImU32 h = key * 0x9E3779B1; // Fibonacci hashing, spread sequential keys
+    return (int)((h ^ (h >> 16)) & (ImU32)(capacity - 1));
+}
+
+static ImGuiStorage::Pair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (key == 0)
+        return storage->HashZeroKeyUsed ? &storage->Data.Data[storage->HashCapacity] : NULL;
+    if (storage->HashCount == 0)
+        return NULL;
+    const int mask = storage->HashCapacity - 1;
+    for (int n = StorageHashSlot(key, storage->HashCapacity); ; n = (n + 1) & mask)
+    {
+        ImGuiStorage::Pair* pair = &storage->Data.Data[n];
+        if (pair->key == key)
+            return pair;
+        if (pair->key == 0)
+            return NULL;
+    }
+}
+
+static void StorageRehash(ImGuiStorage* storage, int new_capacity)
+{
+    IM_ASSERT(new_capacity > 0 && (new_capacity & (new_capacity - 1)) == 0);
+    ImVector<ImGuiStorage::Pair> old_data;
+    old_data.swap(storage->Data);
+    const int old_capacity = storage->HashCapacity;
+    storage->Data.reserve(new_capacity + 1);
+    storage->Data.resize(new_capacity + 1);
+    memset(storage->Data.Data, 0, (size_t)storage->Data.Size * sizeof(ImGuiStorage::Pair));
+    storage->HashCapacity = new_capacity;
+    if (old_capacity == 0)
+        return;
+    storage->Data[new_capacity] = old_data[old_capacity];
+    const int mask = new_capacity - 1;
+    for (int old_n = 0; old_n < old_capacity; old_n++)
+    {
+        const ImGuiStorage::Pair& old_pair = old_data[old_n];
+        if (old_pair.key == 0)
+            continue;
+        int n = StorageHashSlot(old_pair.key, new_capacity);
+        while (storage->Data.Data[n].key != 0)
+            n = (n + 1) & mask;
+        storage->Data.Data[n] = old_pair;
+    }
+}
+
+// Return existing pair, or insert 'new_pair' (key and default value) and return it.
+static ImGuiStorage::Pair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::Pair& new_pair)
+{
+    if (ImGuiStorage::Pair* pair = StorageFind(storage, new_pair.key))
+        return pair;
+    if (new_pair.key == 0)
+    {
+        if (storage->HashCapacity == 0)
+            StorageRehash(storage, 16);
+        storage->HashZeroKeyUsed = true;
+        storage->Data[storage->HashCapacity] = new_pair;
+        return &storage->Data[storage->HashCapacity];
+    }
+
+    // Keep load factor under 3/4
+    if ((storage->HashCount + 1) * 4 > storage->HashCapacity * 3)
+        StorageRehash(storage, storage->HashCapacity ? storage->HashCapacity * 2 : 16);
+    const int mask = storage->HashCapacity - 1;
+    int n = StorageHashSlot(new_pair.key, storage->HashCapacity);
+    while (storage->Data.Data[n].key != 0)
+        n = (n + 1) & mask;
+    storage->Data.Data[n] = new_pair;
+    storage->HashCount++;
+    return &storage->Data.Data[n];
+}
+
+// For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+// Here: pairs pushed after the table slots are moved into the table.
+void ImGuiStorage::BuildSortByKey()
+{
+    const int first_pushed = (HashCapacity > 0) ? HashCapacity + 1 : 0;
+    if (first_pushed >= Data.Size)
+        return;
+    ImVector<Pair> pushed_pairs;
+    pushed_pairs.resize(Data.Size - first_pushed);
+    memcpy(pushed_pairs.Data, Data.Data + first_pushed, (size_t)pushed_pairs.Size * sizeof(Pair));
+    Data.resize(first_pushed);
+
+    // Size the table once
+    int new_capacity = HashCapacity ? HashCapacity : 16;
+    while ((HashCount + pushed_pairs.Size) * 4 > new_capacity * 3)
+        new_capacity *= 2;
+    if (new_capacity != HashCapacity)
+        StorageRehash(this, new_capacity);
+    for (int n = 0; n < pushed_pairs.Size; n++)
+        *StorageFindOrInsert(this, pushed_pairs[n]) = pushed_pairs[n];
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    Pair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    Pair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    Pair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    return &StorageFindOrInsert(this, Pair(key, default_val))->val_i;
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    return &StorageFindOrInsert(this, Pair(key, default_val))->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    return &StorageFindOrInsert(this, Pair(key, default_val))->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    StorageFindOrInsert(this, Pair(key, val))->val_i = val;
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    StorageFindOrInsert(this, Pair(key, val))->val_f = val;
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    StorageFindOrInsert(this, Pair(key, val))->val_p = val;
+}
+
+void ImGuiStorage::SetAllInt(int v)
+{
+    for (int i = 0; i < Data.Size; i++)
+        if (IsPairUsed(i))
+            Data[i].val_i = v;
+}
+
+#else // #ifdef IMGUI_USE_HASHED_STORAGE
+
 // std::lower_bound but without the bullshit
 static ImGuiStorage::Pair* LowerBound(ImVector<ImGuiStorage::Pair>& data, ImGuiID key)
 {
@@ -1959,11 +2227,6 @@ int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
     return it->val_i;
 }
 
-bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
-{
-    return GetInt(key, default_val ? 1 : 0) != 0;
-}
-
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
     ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
@@ -1989,11 +2252,6 @@ int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
     return &it->val_i;
 }
 
-bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
-{
-    return (bool*)GetIntRef(key, default_val ? 1 : 0);
-}
-
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
     ImGuiStorage::Pair* it = LowerBound(Data, key);
@@ -2022,11 +2280,6 @@ void ImGuiStorage::SetInt(ImGuiID key, int val)
     it->val_i = val;
 }
 
-void ImGuiStorage::SetBool(ImGuiID key, bool val)
-{
-    SetInt(key, val ? 1 : 0);
-}
-
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
     ImGuiStorage::Pair* it = LowerBound(Data, key);
@@ -2055,6 +2308,23 @@ void ImGuiStorage::SetAllInt(int v)
         Data[i].val_i = v;
 }
 
+#endif // #ifdef IMGUI_USE_HASHED_STORAGE
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextFilter
 //-----------------------------------------------------------------------------
@@ -2226,6 +2496,223 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTextLog
+//-----------------------------------------------------------------------------
+
+#define IMGUI_TEXT_LOG_CHUNK_SIZE   (64 * 1024)
+
+ImGuiTextLog::ImGuiTextLog(int max_lines)
+{
+    MaxLines = max_lines;
+    AutoScroll = true;
+    ChunkSpare = NULL;
+    LinesFirst = LineNoFirst = 0;
+    FilteredFirst = FilteredLineNoEnd = 0;
+    FilterHash = 0;
+    DrawnLineNoFirst = 0;
+}
+
+ImGuiTextLog::~ImGuiTextLog()
+{
+    Clear();
+}
+
+void ImGuiTextLog::Clear()
+{
+    for (int n = 0; n < Chunks.Size; n++)
+        IM_FREE(Chunks[n].Data);
+    if (ChunkSpare)
+        IM_FREE(ChunkSpare);
+    Chunks.clear();
+    ChunkSpare = NULL;
+    Lines.clear();
+    LinesFirst = LineNoFirst = 0;
+    FilteredLineNos.clear();
+    FilteredFirst = FilteredLineNoEnd = 0;
+    FilterHash = 0;
+    DrawnLineNoFirst = 0;
+}
+
+// Reserve 'len' characters at the end of the storage, plus room for a zero-terminator which is not counted (for ImFormatStringV).
+// Lines never span two chunks, so long lines get their own larger chunk.
+char* ImGuiTextLog::AllocText(int len)
+{
+    Chunk* chunk = Chunks.Size > 0 ? &Chunks.back() : NULL;
+    if (chunk == NULL || chunk->Size + len + 1 > chunk->Capacity)
+    {
+        Chunk new_chunk;
+        new_chunk.Size = 0;
+        new_chunk.Capacity = ImMax(IMGUI_TEXT_LOG_CHUNK_SIZE, len + 1);
+        if (ChunkSpare != NULL && new_chunk.Capacity == IMGUI_TEXT_LOG_CHUNK_SIZE)
+        {
+            new_chunk.Data = ChunkSpare;
+            ChunkSpare = NULL;
+        }
+        else
+        {
+            new_chunk.Data = (char*)IM_ALLOC((size_t)new_chunk.Capacity);
+        }
+        Chunks.push_back(new_chunk);
+        chunk = &Chunks.back();
+    }
+    char* text = chunk->Data + chunk->Size;
+    chunk->Size += len;
+    return text;
+}
+
+// Add one line per '\n' separated segment of stored text, ignoring the last '\n'.
+void ImGuiTextLog::AddLines(const char* text, const char* text_end)
+{
+    const char* line_begin = text;
+    for (;;)
+    {
+        const char* line_end = (const char*)memchr(line_begin, '\n', (size_t)(text_end - line_begin));
+        if (line_end == NULL)
+            line_end = text_end;
+        Line line;
+        line.Begin = line_begin;
+        line.Len = (int)(line_end - line_begin);
+        Lines.push_back(line);
+        if (line_end + 1 >= text_end)
+            break;
+        line_begin = line_end + 1;
+    }
+    if (MaxLines > 0 && GetLinesCount() > MaxLines)
+        DropLines();
+}
+
+// Drop the oldest lines to keep MaxLines. Lines are stored in order, so every chunk before the one holding the oldest line is unused.
+void ImGuiTextLog::DropLines()
+{
+    const int drop_count = GetLinesCount() - MaxLines;
+    LinesFirst += drop_count;
+    LineNoFirst += drop_count;
+
+    const char* oldest_text = Lines[LinesFirst].Begin;
+    int chunks_dropped = 0;
+    while (chunks_dropped < Chunks.Size - 1)
+    {
+        Chunk& chunk = Chunks[chunks_dropped];
+        if (oldest_text >= chunk.Data && oldest_text < chunk.Data + chunk.Capacity)
+            break;
+        if (ChunkSpare == NULL && chunk.Capacity == IMGUI_TEXT_LOG_CHUNK_SIZE)
+            ChunkSpare = chunk.Data;
+        else
+            IM_FREE(chunk.Data);
+        chunks_dropped++;
+    }
+    if (chunks_dropped > 0)
+        Chunks.erase(Chunks.Data, Chunks.Data + chunks_dropped);
+
+    // Erase dropped lines in batch, so each line is moved a constant number of times on average
+    if (LinesFirst * 2 >= Lines.Size)
+    {
+        Lines.erase(Lines.Data, Lines.Data + LinesFirst);
+        LinesFirst = 0;
+    }
+}
+
+void ImGuiTextLog::Append(const char* text, const char* text_end)
+{
+    const int len = text_end ? (int)(text_end - text) : (int)strlen(text);
+    char* dst = AllocText(len);
+    memcpy(dst, text, (size_t)len);
+    AddLines(dst, dst + len);
+}
+
+void ImGuiTextLog::Appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    Appendfv(fmt, args);
+    va_end(args);
+}
+
+void ImGuiTextLog::Appendfv(const char* fmt, va_list args)
+{
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    int len = ImFormatStringV(NULL, 0, fmt, args);
+    if (len < 0)
+        len = 0;
+    char* dst = AllocText(len);
+    ImFormatStringV(dst, (size_t)len + 1, fmt, args_copy);
+    va_end(args_copy);
+    AddLines(dst, dst + len);
+}
+
+void ImGuiTextLog::Draw(const char* str_id, const ImVec2& size, const ImGuiTextFilter* filter)
+{
+    if (!ImGui::BeginChild(str_id, size, false, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    // Update the line numbers passing the filter: forget dropped lines, then only test the lines added since the last call.
+    // When the filter changes we start again from the oldest line. Results are kept while the filter is inactive.
+    const bool filter_active = (filter != NULL && filter->IsActive());
+    int rows_dropped = 0;
+    if (!filter_active)
+    {
+        rows_dropped = LineNoFirst - DrawnLineNoFirst;
+    }
+    else
+    {
+        const ImGuiID filter_hash = ImHashStr(filter->InputBuf);
+        if (filter_hash != FilterHash)
+        {
+            FilteredLineNos.resize(0);
+            FilteredFirst = 0;
+            FilteredLineNoEnd = LineNoFirst;
+            FilterHash = filter_hash;
+        }
+        while (FilteredFirst < FilteredLineNos.Size && FilteredLineNos[FilteredFirst] < LineNoFirst)
+        {
+            FilteredFirst++;
+            rows_dropped++;
+        }
+        if (FilteredFirst > 0 && FilteredFirst * 2 >= FilteredLineNos.Size)
+        {
+            FilteredLineNos.erase(FilteredLineNos.Data, FilteredLineNos.Data + FilteredFirst);
+            FilteredFirst = 0;
+        }
+        const int line_no_end = LineNoFirst + GetLinesCount();
+        for (int line_no = ImMax(FilteredLineNoEnd, LineNoFirst); line_no < line_no_end; line_no++)
+        {
+            const Line& line = Lines[LinesFirst + line_no - LineNoFirst];
+            if (filter->PassFilter(line.Begin, line.Begin + line.Len))
+                FilteredLineNos.push_back(line_no);
+        }
+        FilteredLineNoEnd = line_no_end;
+    }
+    DrawnLineNoFirst = LineNoFirst;
+
+    // Keep showing the same lines when older lines are dropped, unless we are following the last line
+    const float line_height = ImGui::GetTextLineHeight();
+    const bool scroll_to_bottom = AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+    if (rows_dropped > 0 && !scroll_to_bottom)
+        ImGui::SetScrollY(ImMax(ImGui::GetScrollY() - rows_dropped * line_height, 0.0f));
+
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+    const int rows_count = filter_active ? FilteredLineNos.Size - FilteredFirst : GetLinesCount();
+    ImGuiListClipper clipper(rows_count, line_height);
+    while (clipper.Step())
+        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+        {
+            const int line_n = filter_active ? FilteredLineNos[FilteredFirst + row_n] - LineNoFirst : row_n;
+            const Line& line = Lines[LinesFirst + line_n];
+            ImGui::TextUnformatted(line.Begin, line.Begin + line.Len);
+        }
+    ImGui::PopStyleVar();
+
+    if (scroll_to_bottom)
+        ImGui::SetScrollHereY(1.0f);
+    ImGui::EndChild();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be, needs some rework (see TODO)
@@ -2254,61 +2741,442 @@ void ImGuiListClipper::Begin(int count, float items_height)
     ItemsCount = count;
     StepNo = 0;
     DisplayEnd = DisplayStart = -1;
+    Heights = NULL;
     if (ItemsHeight > 0.0f)
     {
-        ImGui::CalcListClipping(ItemsCount, ItemsHeight, &DisplayStart, &DisplayEnd); // calculate how many to clip/display
-        if (DisplayStart > 0)
-            SetCursorPosYAndSetupDummyPrevLine(StartPosY + DisplayStart * ItemsHeight, ItemsHeight); // advance cursor
-        StepNo = 2;
+        ImGui::CalcListClipping(ItemsCount, ItemsHeight, &DisplayStart, &DisplayEnd); // calculate how many to clip/display
+        if (DisplayStart > 0)
+            SetCursorPosYAndSetupDummyPrevLine(StartPosY + DisplayStart * ItemsHeight, ItemsHeight); // advance cursor
+        StepNo = 2;
+    }
+}
+
+// Items of different heights: same visible area as CalcListClipping(), but we stop displaying items once the cursor crossed it (see Step())
+void ImGuiListClipper::Begin(int count, ImGuiListClipperHeights* heights)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(count >= 0 && count < INT_MAX && heights != NULL);
+    StartPosY = ImGui::GetCursorPosY();
+    ItemsHeight = -1.0f;
+    ItemsCount = count;
+    Heights = heights;
+    if (heights->DefaultHeight <= 0.0f)
+        heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    heights->Resize(count);
+
+    int start = 0;
+    ClipEndPosY = FLT_MAX;
+    if (!g.LogEnabled)
+    {
+        ImRect unclipped_rect = window->ClipRect;
+        if (g.NavMoveRequest)
+            unclipped_rect.Add(g.NavScoringRectScreen);
+        start = heights->FindItemAtOffset(unclipped_rect.Min.y - window->DC.CursorPos.y);
+        ClipEndPosY = unclipped_rect.Max.y;
+
+        // When performing a navigation request, ensure we have one item extra in the direction we are moving to
+        if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up)
+            start--;
+        if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down)
+            ClipEndPosY += heights->GetEstimatedHeight();
+        start = ImClamp(start, 0, count);
+    }
+    // Offsets are rounded down, so items start at the same integer positions as with ItemSize() and their measured heights stay exact
+    AnchorItem = start;
+    AnchorOffset = floor(heights->GetItemOffset(start));
+    if (start > 0)
+        SetCursorPosYAndSetupDummyPrevLine(StartPosY + (float)AnchorOffset, heights->GetItemHeight(start - 1));
+    DisplayStart = DisplayEnd = start;
+    StepNo = 4;
+}
+
+void ImGuiListClipper::End()
+{
+    if (ItemsCount < 0)
+        return;
+    if (Heights)
+    {
+        // Items of different heights: the items before the first item displayed may have a new estimated height. Scroll so it stays in place.
+        const double anchor_offset = floor(Heights->GetItemOffset(AnchorItem));
+        if (anchor_offset != AnchorOffset)
+            ImGui::SetScrollY(ImGui::GetScrollY() + (float)(anchor_offset - AnchorOffset));
+        SetCursorPosYAndSetupDummyPrevLine(StartPosY + (float)floor(Heights->GetTotalHeight()), ItemsCount > 0 ? Heights->GetItemHeight(ItemsCount - 1) : 0.0f);
+        ItemsCount = -1;
+        StepNo = 5;
+        return;
+    }
+    // In theory here we should assert that ImGui::GetCursorPosY() == StartPosY + DisplayEnd * ItemsHeight, but it feels saner to just seek at the end and not assert/crash the user.
+    if (ItemsCount < INT_MAX)
+        SetCursorPosYAndSetupDummyPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight); // advance cursor
+    ItemsCount = -1;
+    StepNo = 3;
+}
+
+bool ImGuiListClipper::Step()
+{
+    if (ItemsCount == 0 || ImGui::GetCurrentWindowRead()->SkipItems)
+    {
+        ItemsCount = -1;
+        return false;
+    }
+    if (StepNo == 4) // Step 4: items of different heights. Measure the item we just displayed, then display the next one if we haven't filled the visible area.
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindowRead();
+        if (DisplayEnd > DisplayStart)
+            Heights->SetItemHeight(DisplayStart, window->DC.CursorPos.y - ItemStartPosY);
+        if (DisplayEnd < ItemsCount && window->DC.CursorPos.y < ClipEndPosY)
+        {
+            DisplayStart = DisplayEnd++;
+            ItemStartPosY = window->DC.CursorPos.y;
+            return true;
+        }
+        End();
+        return false;
+    }
+    if (StepNo == 0) // Step 0: the clipper let you process the first element, regardless of it being visible or not, so we can measure the element height.
+    {
+        DisplayStart = 0;
+        DisplayEnd = 1;
+        StartPosY = ImGui::GetCursorPosY();
+        StepNo = 1;
+        return true;
+    }
+    if (StepNo == 1) // Step 1: the clipper infer height from first element, calculate the actual range of elements to display, and position the cursor before the first element.
+    {
+        if (ItemsCount == 1) { ItemsCount = -1; return false; }
+        float items_height = ImGui::GetCursorPosY() - StartPosY;
+        IM_ASSERT(items_height > 0.0f);   // If this triggers, it means Item 0 hasn't moved the cursor vertically
+        Begin(ItemsCount-1, items_height);
+        DisplayStart++;
+        DisplayEnd++;
+        StepNo = 3;
+        return true;
+    }
+    if (StepNo == 2) // Step 2: dummy step only required if an explicit items_height was passed to constructor or Begin() and user still call Step(). Does nothing and switch to Step 3.
+    {
+        IM_ASSERT(DisplayStart >= 0 && DisplayEnd >= 0);
+        StepNo = 3;
+        return true;
+    }
+    if (StepNo == 3) // Step 3: the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd), advance the cursor to the end of the list and then returns 'false' to end the loop.
+        End();
+    return false;
+}
+
+// Fenwick tree: TreeXXX[i - 1] holds the sum over items [i - (i & -i), i - 1]. Unmeasured items are counted apart so their estimated height can change freely.
+void ImGuiListClipperHeights::Clear()
+{
+    ItemHeights.clear();
+    TreeHeights.clear();
+    TreeUnmeasured.clear();
+    MeasuredTotal = 0.0;
+    MeasuredCount = 0;
+}
+
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    if (items_count < ItemHeights.Size)
+    {
+        // Tree nodes only cover items before them, so we can simply remove the last ones
+        for (int n = items_count; n < ItemHeights.Size; n++)
+            if (ItemHeights[n] >= 0.0f)
+            {
+                MeasuredTotal -= ItemHeights[n];
+                MeasuredCount--;
+            }
+        ItemHeights.resize(items_count);
+        TreeHeights.resize(items_count);
+        TreeUnmeasured.resize(items_count);
+        return;
+    }
+    ItemHeights.reserve(items_count);
+    TreeHeights.reserve(items_count);
+    TreeUnmeasured.reserve(items_count);
+    for (int i = ItemHeights.Size + 1; i <= items_count; i++)
+    {
+        // Add an unmeasured item: sum the nodes covering the rest of the range of the new node
+        double sum_heights = 0.0;
+        int sum_unmeasured = 1;
+        for (int j = i - 1; j > i - (i & -i); j -= (j & -j))
+        {
+            sum_heights += TreeHeights[j - 1];
+            sum_unmeasured += TreeUnmeasured[j - 1];
+        }
+        ItemHeights.push_back(-1.0f);
+        TreeHeights.push_back(sum_heights);
+        TreeUnmeasured.push_back(sum_unmeasured);
+    }
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < ItemHeights.Size);
+    const float old_height = ItemHeights[item_n];
+    if (height < 0.0f)
+        height = -1.0f;
+    if (old_height == height)
+        return;
+    const double d_height = (double)ImMax(height, 0.0f) - (double)ImMax(old_height, 0.0f);
+    const int d_unmeasured = (height < 0.0f ? 1 : 0) - (old_height < 0.0f ? 1 : 0);
+    ItemHeights[item_n] = height;
+    MeasuredTotal += d_height;
+    MeasuredCount -= d_unmeasured;
+    for (int i = item_n + 1; i <= ItemHeights.Size; i += (i & -i))
+    {
+        TreeHeights[i - 1] += d_height;
+        TreeUnmeasured[i - 1] += d_unmeasured;
+    }
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= ItemHeights.Size);
+    double sum_heights = 0.0;
+    int sum_unmeasured = 0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+    {
+        sum_heights += TreeHeights[i - 1];
+        sum_unmeasured += TreeUnmeasured[i - 1];
+    }
+    return sum_heights + sum_unmeasured * (double)GetEstimatedHeight();
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Descend the tree, skipping every node which ends before 'offset'
+    const double estimated_height = GetEstimatedHeight();
+    int step = 1;
+    while (step * 2 <= ItemHeights.Size)
+        step *= 2;
+    int item_n = 0;
+    for (; step > 0; step >>= 1)
+    {
+        const int i = item_n + step;
+        if (i > ItemHeights.Size)
+            continue;
+        const double node_height = TreeHeights[i - 1] + TreeUnmeasured[i - 1] * estimated_height;
+        if (node_height <= offset)
+        {
+            item_n = i;
+            offset -= node_height;
+        }
+    }
+    return item_n;
+}
+
+// Switch to another column of the current columns set and move the cursor to 'pos_y', like NextColumn() does
+static void SetCursorToColumnsSetColumn(int column_index, float pos_y)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiColumns* columns = window->DC.CurrentColumns;
+    columns->LineMaxY = ImMax(columns->LineMaxY, window->DC.CursorPos.y);
+    if (columns->Count > 1 && column_index != columns->Current)
+    {
+        ImGui::PopItemWidth();
+        ImGui::PopClipRect();
+        columns->Current = column_index;
+        window->DC.ColumnsOffset.x = (column_index > 0) ? ImGui::GetColumnOffset(column_index) - window->DC.Indent.x + g.Style.ItemSpacing.x : 0.0f;
+        window->DrawList->ChannelsSetCurrent(column_index + 1);
+        ImGui::PushColumnClipRect(column_index);
+        ImGui::PushItemWidth(ImGui::GetColumnWidth() * 0.65f);
+    }
+    window->DC.CursorPos.x = (float)(int)(window->Pos.x + window->DC.Indent.x + window->DC.ColumnsOffset.x);
+    window->DC.CursorPos.y = pos_y;
+    window->DC.CurrLineSize = ImVec2(0.0f, 0.0f);
+    window->DC.CurrLineTextBaseOffset = 0.0f;
+}
+
+// Same visible area as CalcListClipping(), on both axes
+void ImGuiGridClipper::Begin(int rows_count, int columns_count, const ImVec2& cell_size, ImGuiListClipperHeights* rows_heights, const float* columns_widths)
+{
+    RowsCount = rows_count;
+    ColumnsCount = columns_count;
+    CellSize = cell_size;
+    RowsHeights = rows_heights;
+    ColumnsWidths = columns_widths;
+    StepNo = 0;
+    DisplayRowStart = DisplayRowEnd = DisplayColumnStart = DisplayColumnEnd = 0;
+    ColumnStartOffsetX = 0.0f;
+    CellRow = CellColumn = -1;
+    CellOffset = ImVec2(0.0f, 0.0f);
+    InColumnsSet = false;
+    if (rows_count < 0)
+    {
+        RowsCount = -1;
+        return;
+    }
+
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    StartPos = ImGui::GetCursorPos();
+    InColumnsSet = (window->DC.CurrentColumns != NULL);
+    IM_ASSERT(columns_count >= 0 && rows_count < INT_MAX);
+    IM_ASSERT(!InColumnsSet || columns_count == window->DC.CurrentColumns->Count);
+    IM_ASSERT(rows_heights != NULL || cell_size.y > 0.0f);
+    IM_ASSERT(columns_widths != NULL || InColumnsSet || cell_size.x > 0.0f);
+    if (rows_heights)
+    {
+        if (rows_heights->DefaultHeight <= 0.0f)
+            rows_heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+        rows_heights->Resize(rows_count);
+    }
+    if (window->SkipItems)
+        return;
+    if (g.LogEnabled)
+    {
+        // If logging is active, do not perform any clipping
+        DisplayRowEnd = rows_count;
+        DisplayColumnEnd = columns_count;
+        return;
+    }
+
+    // Inside a columns set, ClipRect is the one of the current column
+    ImRect unclipped_rect = InColumnsSet ? window->DC.CurrentColumns->HostClipRect : window->ClipRect;
+    if (g.NavMoveRequest)
+        unclipped_rect.Add(g.NavScoringRectScreen);
+    const ImVec2 pos = window->DC.CursorPos;
+
+    // Rows
+    int start, end;
+    if (rows_heights)
+    {
+        start = rows_heights->FindItemAtOffset(unclipped_rect.Min.y - pos.y);
+        end = rows_heights->FindItemAtOffset(unclipped_rect.Max.y - pos.y);
+    }
+    else
+    {
+        start = (int)((unclipped_rect.Min.y - pos.y) / cell_size.y);
+        end = (int)((unclipped_rect.Max.y - pos.y) / cell_size.y);
+    }
+    if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up)
+        start--;
+    if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down)
+        end++;
+    DisplayRowStart = ImClamp(start, 0, rows_count);
+    DisplayRowEnd = ImClamp(end + 1, DisplayRowStart, rows_count);
+
+    // Columns
+    if (InColumnsSet)
+    {
+        start = 0;
+        while (start < columns_count && window->Pos.x + ImGui::GetColumnOffset(start + 1) <= unclipped_rect.Min.x)
+            start++;
+        end = start;
+        while (end < columns_count - 1 && window->Pos.x + ImGui::GetColumnOffset(end + 1) < unclipped_rect.Max.x)
+            end++;
     }
+    else if (columns_widths)
+    {
+        float offset = 0.0f;
+        start = 0;
+        while (start < columns_count && pos.x + offset + columns_widths[start] <= unclipped_rect.Min.x)
+            offset += columns_widths[start++];
+        end = start;
+        while (end < columns_count - 1 && pos.x + offset + columns_widths[end] < unclipped_rect.Max.x)
+            offset += columns_widths[end++];
+    }
+    else
+    {
+        start = (int)((unclipped_rect.Min.x - pos.x) / cell_size.x);
+        end = (int)((unclipped_rect.Max.x - pos.x) / cell_size.x);
+    }
+    if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Left)
+        start--;
+    if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Right)
+        end++;
+    DisplayColumnStart = ImClamp(start, 0, columns_count);
+    DisplayColumnEnd = ImClamp(end + 1, DisplayColumnStart, columns_count);
+    if (columns_widths)
+        for (int n = 0; n < DisplayColumnStart; n++)
+            ColumnStartOffsetX += columns_widths[n];
 }
 
-void ImGuiListClipper::End()
+void ImGuiGridClipper::End()
 {
-    if (ItemsCount < 0)
+    if (RowsCount < 0)
         return;
-    // In theory here we should assert that ImGui::GetCursorPosY() == StartPosY + DisplayEnd * ItemsHeight, but it feels saner to just seek at the end and not assert/crash the user.
-    if (ItemsCount < INT_MAX)
-        SetCursorPosYAndSetupDummyPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight); // advance cursor
-    ItemsCount = -1;
-    StepNo = 3;
+
+    // Advance the cursor past the grid, and extend the contents size to its right edge so we get an horizontal scrollbar
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    const float total_height = RowsHeights ? (float)floor(RowsHeights->GetTotalHeight()) : RowsCount * CellSize.y;
+    const float last_row_height = (RowsCount == 0) ? 0.0f : RowsHeights ? RowsHeights->GetItemHeight(RowsCount - 1) : CellSize.y;
+    if (InColumnsSet)
+    {
+        SetCursorToColumnsSetColumn(0, window->Pos.y - window->Scroll.y + StartPos.y + total_height);
+        window->DC.CurrentColumns->LineMaxY = window->DC.CursorPos.y;
+    }
+    else
+    {
+        float total_width = 0.0f;
+        if (ColumnsWidths)
+            for (int n = 0; n < ColumnsCount; n++)
+                total_width += ColumnsWidths[n];
+        else
+            total_width = ColumnsCount * CellSize.x;
+        window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, window->Pos.x - window->Scroll.x + StartPos.x + total_width);
+        ImGui::SetCursorPosX(StartPos.x);
+    }
+    SetCursorPosYAndSetupDummyPrevLine(StartPos.y + total_height, last_row_height);
+    RowsCount = -1;
+    StepNo = 2;
 }
 
-bool ImGuiListClipper::Step()
+bool ImGuiGridClipper::Step()
 {
-    if (ItemsCount == 0 || ImGui::GetCurrentWindowRead()->SkipItems)
+    if (RowsCount == 0 || ColumnsCount == 0 || ImGui::GetCurrentWindowRead()->SkipItems)
     {
-        ItemsCount = -1;
+        RowsCount = -1;
         return false;
     }
-    if (StepNo == 0) // Step 0: the clipper let you process the first element, regardless of it being visible or not, so we can measure the element height.
+    if (StepNo == 0) // Step 0: cells to display were calculated by Begin()
     {
-        DisplayStart = 0;
-        DisplayEnd = 1;
-        StartPosY = ImGui::GetCursorPosY();
         StepNo = 1;
         return true;
     }
-    if (StepNo == 1) // Step 1: the clipper infer height from first element, calculate the actual range of elements to display, and position the cursor before the first element.
+    End(); // Step 1: advance the cursor to the end of the grid and return 'false' to end the loop
+    return false;
+}
+
+void ImGuiGridClipper::SetCursorToCell(int row, int column)
+{
+    IM_ASSERT(row >= 0 && row < RowsCount && column >= 0 && column < ColumnsCount);
+    if (row != CellRow)
     {
-        if (ItemsCount == 1) { ItemsCount = -1; return false; }
-        float items_height = ImGui::GetCursorPosY() - StartPosY;
-        IM_ASSERT(items_height > 0.0f);   // If this triggers, it means Item 0 hasn't moved the cursor vertically
-        Begin(ItemsCount-1, items_height);
-        DisplayStart++;
-        DisplayEnd++;
-        StepNo = 3;
-        return true;
+        CellOffset.y = RowsHeights ? (float)floor(RowsHeights->GetItemOffset(row)) : row * CellSize.y;
+        CellRow = row;
     }
-    if (StepNo == 2) // Step 2: dummy step only required if an explicit items_height was passed to constructor or Begin() and user still call Step(). Does nothing and switch to Step 3.
+    if (InColumnsSet)
     {
-        IM_ASSERT(DisplayStart >= 0 && DisplayEnd >= 0);
-        StepNo = 3;
-        return true;
+        ImGuiWindow* window = GImGui->CurrentWindow;
+        SetCursorToColumnsSetColumn(column, window->Pos.y - window->Scroll.y + StartPos.y + CellOffset.y);
+        return;
     }
-    if (StepNo == 3) // Step 3: the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd), advance the cursor to the end of the list and then returns 'false' to end the loop.
-        End();
-    return false;
+    if (column != CellColumn)
+    {
+        if (ColumnsWidths)
+        {
+            // Sum widths from the previous cell or from the first visible column, so iterating over visible cells is O(1) per cell
+            int n = CellColumn;
+            float offset = CellOffset.x;
+            if (n < 0 || column < n)
+            {
+                n = (column >= DisplayColumnStart) ? DisplayColumnStart : 0;
+                offset = (column >= DisplayColumnStart) ? ColumnStartOffsetX : 0.0f;
+            }
+            for (; n < column; n++)
+                offset += ColumnsWidths[n];
+            CellOffset.x = offset;
+        }
+        else
+        {
+            CellOffset.x = column * CellSize.x;
+        }
+        CellColumn = column;
+    }
+    ImGui::SetCursorPos(StartPos + CellOffset);
 }
 
 //-----------------------------------------------------------------------------
@@ -2350,7 +3218,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 
     if (text != text_display_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
+        AddTextCached(window->DrawList, g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_display_end);
     }
@@ -2366,7 +3234,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        AddTextCached(window->DrawList, g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -2394,11 +3262,11 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     if (need_clipping)
     {
         ImVec4 fine_clip_rect(clip_min->x, clip_min->y, clip_max->x, clip_max->y);
-        draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, &fine_clip_rect);
+        AddTextCached(draw_list, NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, &fine_clip_rect);
     }
     else
     {
-        draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
+        AddTextCached(draw_list, NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
     }
 }
 
@@ -2581,6 +3449,8 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     HiddenFramesCanSkipItems = HiddenFramesCannotSkipItems = 0;
     SetWindowPosAllowFlags = SetWindowSizeAllowFlags = SetWindowCollapsedAllowFlags = ImGuiCond_Always | ImGuiCond_Once | ImGuiCond_FirstUseEver | ImGuiCond_Appearing;
     SetWindowPosVal = SetWindowPosPivot = ImVec2(FLT_MAX, FLT_MAX);
+    SpatialIndexRect = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    DisplayOrder = -1;
 
     LastFrameActive = -1;
     ItemWidthDefault = 0.0f;
@@ -3000,10 +3870,11 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 }
 
 // IM_ALLOC() == ImGui::MemAlloc()
+// Memory may be allocated from worker threads (multi-threaded font atlas build, ImDrawList recording), so the counter is updated atomically.
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
+        ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, 1);
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
 }
 
@@ -3012,7 +3883,7 @@ void ImGui::MemFree(void* ptr)
 {
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+            ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, -1);
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
@@ -3447,6 +4318,7 @@ void ImGui::NewFrame()
     IM_ASSERT(g.IO.Fonts->Fonts.Size > 0                                && "Font Atlas not built. Did you call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8() ?");
     IM_ASSERT(g.IO.Fonts->Fonts[0]->IsLoaded()                          && "Font Atlas not built. Did you call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8() ?");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
+    IM_ASSERT(g.Style.CircleSegmentMaxError > 0.0f                      && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting. Alpha cannot be negative (allows us to avoid a few clamps in color computations)!");
     IM_ASSERT(g.Style.WindowMinSize.x >= 1.0f && g.Style.WindowMinSize.y >= 1.0f && "Invalid style setting.");
     for (int n = 0; n < ImGuiKey_COUNT; n++)
@@ -3490,19 +4362,24 @@ void ImGui::NewFrame()
     g.WindowsActiveCount = 0;
 
     // Setup current font and draw list shared data
+    ImFontAtlasUpdateDynamicGlyphs(g.IO.Fonts);
     g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
+    UpdateTextSizeCache();
+    UpdateTextLineIndices();
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
     g.DrawListSharedData.CurveTessellationTol = g.Style.CurveTessellationTol;
+    if (g.DrawListSharedData.CircleSegmentMaxError != g.Style.CircleSegmentMaxError)
+        g.DrawListSharedData.SetCircleSegmentMaxError(g.Style.CircleSegmentMaxError);
 
     g.BackgroundDrawList.Clear();
-    g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
+    g.BackgroundDrawList.PushTextureID(g.Font->GetTexID());
     g.BackgroundDrawList.PushClipRectFullScreen();
     g.BackgroundDrawList.Flags = (g.Style.AntiAliasedLines ? ImDrawListFlags_AntiAliasedLines : 0) | (g.Style.AntiAliasedFill ? ImDrawListFlags_AntiAliasedFill : 0);
 
     g.ForegroundDrawList.Clear();
-    g.ForegroundDrawList.PushTextureID(g.IO.Fonts->TexID);
+    g.ForegroundDrawList.PushTextureID(g.Font->GetTexID());
     g.ForegroundDrawList.PushClipRectFullScreen();
     g.ForegroundDrawList.Flags = (g.Style.AntiAliasedLines ? ImDrawListFlags_AntiAliasedLines : 0) | (g.Style.AntiAliasedFill ? ImDrawListFlags_AntiAliasedFill : 0);
 
@@ -3709,6 +4586,11 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ForegroundDrawList.ClearFreeMemory();
     g.PrivateClipboard.clear();
     g.InputTextState.ClearFreeMemory();
+    g.TextSizeCache.Clear();
+    for (int i = 0; i < g.TextLineIndices.Size; i++)
+        IM_DELETE(g.TextLineIndices[i]);
+    g.TextLineIndices.clear();
+    g.WindowsSpatialIndex.Clear();
 
     for (int i = 0; i < g.SettingsWindows.Size; i++)
         IM_DELETE(g.SettingsWindows[i].Name);
@@ -3739,6 +4621,7 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
 
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
+    window->DisplayOrder = out_sorted_windows->Size;
     out_sorted_windows->push_back(window);
     if (window->Active)
     {
@@ -3843,6 +4726,26 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
         draw_data->TotalIdxCount += draw_lists->Data[n]->IdxBuffer.Size;
     }
+
+    // Compute content signatures if the renderer back-end wants them
+    if (io.BackendFlags & ImGuiBackendFlags_RendererUsesContentSignatures)
+    {
+        const float display_params[6] = { draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplaySize.x, draw_data->DisplaySize.y, draw_data->FramebufferScale.x, draw_data->FramebufferScale.y };
+        ImU32 h_lo = ImHashData(display_params, sizeof(display_params));
+        ImU32 h_hi = ImHashData(display_params, sizeof(display_params), 0x9E3779B9);
+        for (int n = 0; n < draw_lists->Size; n++)
+        {
+            ImDrawList* draw_list = draw_lists->Data[n];
+            draw_list->ContentSignature = draw_list->CalcContentSignature();
+            h_lo = ImHashData(&draw_list->ContentSignature, sizeof(ImU64), h_lo);
+            h_hi = ImHashData(&draw_list->ContentSignature, sizeof(ImU64), h_hi);
+        }
+        draw_data->ContentSignature = ((ImU64)h_hi << 32) | h_lo;
+    }
+    else
+    {
+        draw_data->ContentSignature = 0;
+    }
 }
 
 // When using this function it is sane to ensure that float are perfectly rounded to integer values, to that e.g. (int)(max.x-min.x) in user's render produce correct result.
@@ -4000,6 +4903,135 @@ void ImGui::Render()
 #endif
 }
 
+// 64-bit hash for the text size cache, 8 bytes at a time. Results depend on endianness, don't use them for IDs.
+static ImU64 ImHashText64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end_aligned = data + (data_size & ~(size_t)7);
+    ImU64 h = seed ^ ((ImU64)data_size * k);
+    for (; data < data_end_aligned; data += 8)
+    {
+        ImU64 w;
+        memcpy(&w, data, 8);
+        h = (h ^ w) * k;
+        h ^= h >> 32;
+    }
+    if (data_size & 7)
+    {
+        ImU64 w = 0;
+        memcpy(&w, data, data_size & 7);
+        h = (h ^ w) * k;
+        h ^= h >> 32;
+    }
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline bool TextSizeCacheEntryMatches(const ImGuiTextSizeCache& cache, const ImGuiTextSizeCacheEntry& entry, const ImFont* font, int font_build_count, float font_size, float wrap_width, const char* text, int text_len)
+{
+    return entry.TextLen == text_len && entry.Font == font && entry.FontBuildCount == font_build_count && entry.FontSize == font_size && entry.WrapWidth == wrap_width
+        && memcmp(cache.TextBuf.Data + entry.TextOffset, text, (size_t)text_len) == 0;
+}
+
+static void RebuildTextSizeCacheBuckets(ImGuiTextSizeCache& cache, int buckets_count)
+{
+    IM_ASSERT(ImIsPowerOfTwo(buckets_count) && buckets_count >= cache.Entries.Size * 2);
+    cache.Buckets.resize(buckets_count);
+    memset(cache.Buckets.Data, 0xFF, (size_t)cache.Buckets.size_in_bytes());
+    const int mask = buckets_count - 1;
+    for (int n = 0; n < cache.Entries.Size; n++)
+    {
+        int bucket = (int)(cache.Entries[n].Hash & (ImU64)mask);
+        while (cache.Buckets[bucket] != -1)
+            bucket = (bucket + 1) & mask;
+        cache.Buckets[bucket] = n;
+    }
+    for (int n = 0; n < IMGUI_TEXT_SIZE_CACHE_ADDR_SLOTS; n++)
+        cache.AddrSlots[n] = -1;
+}
+
+// Find a text measured by CalcTextSize() with io.ConfigTextSizeCache set. wrap_width <= 0.0f must be passed as 0.0f.
+// The hash is only computed if the text address differs from the last lookup of the entry. On a miss, output it for AddTextSizeCacheEntry().
+ImGuiTextSizeCacheEntry* ImGui::FindTextSizeCacheEntry(const ImFont* font, float font_size, float wrap_width, const char* text, int text_len, ImU64* out_hash)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    const int font_build_count = font->ContainerAtlas ? font->ContainerAtlas->BuildCount : 0;
+
+    // Fast path: same address as a recent lookup. The contents are still compared, the text may have been modified in place.
+    int* addr_slot = &cache.AddrSlots[(((size_t)text >> 2) ^ (size_t)text_len) % IMGUI_TEXT_SIZE_CACHE_ADDR_SLOTS];
+    if (*addr_slot != -1)
+    {
+        ImGuiTextSizeCacheEntry& entry = cache.Entries[*addr_slot];
+        if (entry.TextAddr == text && TextSizeCacheEntryMatches(cache, entry, font, font_build_count, font_size, wrap_width, text, text_len))
+        {
+            entry.LastFrameUsed = g.FrameCount;
+            return &entry;
+        }
+    }
+
+    ImU32 font_size_bits, wrap_width_bits;
+    memcpy(&font_size_bits, &font_size, 4);
+    memcpy(&wrap_width_bits, &wrap_width, 4);
+    const ImU64 seed = ((ImU64)(size_t)font * 31 + (ImU64)(unsigned int)font_build_count) ^ (((ImU64)font_size_bits << 32) | wrap_width_bits);
+    const ImU64 hash = ImHashText64(text, (size_t)text_len, seed);
+    if (out_hash)
+        *out_hash = hash;
+    if (cache.Buckets.empty())
+        return NULL;
+
+    const int mask = cache.Buckets.Size - 1;
+    for (int bucket = (int)(hash & (ImU64)mask); cache.Buckets[bucket] != -1; bucket = (bucket + 1) & mask)
+    {
+        ImGuiTextSizeCacheEntry& entry = cache.Entries[cache.Buckets[bucket]];
+        if (entry.Hash == hash && TextSizeCacheEntryMatches(cache, entry, font, font_build_count, font_size, wrap_width, text, text_len))
+        {
+            entry.TextAddr = text;
+            entry.LastFrameUsed = g.FrameCount;
+            *addr_slot = cache.Buckets[bucket];
+            return &entry;
+        }
+    }
+    return NULL;
+}
+
+static void AddTextSizeCacheEntry(const ImFont* font, float font_size, float wrap_width, const char* text, int text_len, ImU64 hash, const ImVec2& size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    if ((cache.Entries.Size + 1) * 2 > cache.Buckets.Size)
+        RebuildTextSizeCacheBuckets(cache, ImMax(256, cache.Buckets.Size * 2));
+
+    const int entry_idx = cache.Entries.Size;
+    cache.Entries.resize(cache.Entries.Size + 1);
+    ImGuiTextSizeCacheEntry& entry = cache.Entries[entry_idx];
+    entry.Hash = hash;
+    entry.TextAddr = text;
+    entry.TextOffset = cache.TextBuf.Size;
+    entry.TextLen = text_len;
+    entry.Font = font;
+    entry.FontBuildCount = font->ContainerAtlas ? font->ContainerAtlas->BuildCount : 0;
+    entry.FontSize = font_size;
+    entry.WrapWidth = wrap_width;
+    entry.LastFrameUsed = g.FrameCount;
+    entry.Size = size;
+    const bool can_lay_out = (wrap_width == 0.0f && text_len <= IMGUI_TEXT_SIZE_CACHE_LAYOUT_MAX_LEN && !(font->ContainerAtlas && font->ContainerAtlas->DynamicData));
+    entry.GlyphsOffset = can_lay_out ? -1 : -2;
+    entry.GlyphsCount = 0;
+    cache.TextBuf.resize(cache.TextBuf.Size + text_len);
+    memcpy(cache.TextBuf.Data + entry.TextOffset, text, (size_t)text_len);
+
+    const int mask = cache.Buckets.Size - 1;
+    int bucket = (int)(hash & (ImU64)mask);
+    while (cache.Buckets[bucket] != -1)
+        bucket = (bucket + 1) & mask;
+    cache.Buckets[bucket] = entry_idx;
+    cache.AddrSlots[(((size_t)text >> 2) ^ (size_t)text_len) % IMGUI_TEXT_SIZE_CACHE_ADDR_SLOTS] = entry_idx;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, GImGui->FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -4016,14 +5048,224 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+    // Lookup in cache (io.ConfigTextSizeCache)
+    ImU64 cache_hash = 0;
+    int text_len = 0;
+    bool use_cache = false;
+    const float cache_wrap_width = (wrap_width > 0.0f) ? wrap_width : 0.0f;
+    if (g.IO.ConfigTextSizeCache)
+    {
+        text_len = (int)(text_display_end ? (size_t)(text_display_end - text) : strlen(text));
+        use_cache = (text_len >= IMGUI_TEXT_SIZE_CACHE_MIN_LEN || (wrap_width > 0.0f && text_len > 0));
+    }
+    if (use_cache)
+    {
+        if (ImGuiTextSizeCacheEntry* entry = FindTextSizeCacheEntry(font, font_size, cache_wrap_width, text, text_len, &cache_hash))
+        {
+            g.TextSizeCache.Hits++;
+            return entry->Size;
+        }
+        g.TextSizeCache.Misses++;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     text_size.x = (float)(int)(text_size.x + 0.95f);
 
+    if (use_cache)
+        AddTextSizeCacheEntry(font, font_size, cache_wrap_width, text, text_len, cache_hash, text_size);
+
     return text_size;
 }
 
+// Same as draw_list->AddText(). With io.ConfigTextSizeCache, unwrapped texts measured by CalcTextSize() are rendered from the glyphs kept in the cache.
+void ImGui::AddTextCached(ImDrawList* draw_list, const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    if (!g.IO.ConfigTextSizeCache || wrap_width > 0.0f || text_len < IMGUI_TEXT_SIZE_CACHE_MIN_LEN || text_len > IMGUI_TEXT_SIZE_CACHE_LAYOUT_MAX_LEN || (col & IM_COL32_A_MASK) == 0)
+    {
+        draw_list->AddText(font, font_size, pos, col, text, text_end, wrap_width, cpu_fine_clip_rect);
+        return;
+    }
+
+    // Pull default font/size from the shared ImDrawListSharedData instance, like AddText()
+    if (font == NULL)
+        font = draw_list->_Data->Font;
+    if (font_size == 0.0f)
+        font_size = draw_list->_Data->FontSize;
+
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    ImGuiTextSizeCacheEntry* entry = FindTextSizeCacheEntry(font, font_size, 0.0f, text, text_len, NULL);
+    if (entry && entry->GlyphsOffset == -1)
+    {
+        const int glyphs_offset = cache.Glyphs.Size;
+        if (ImFontLayoutText(font, text, text_end, &cache.Glyphs))
+        {
+            entry->GlyphsOffset = glyphs_offset;
+            entry->GlyphsCount = cache.Glyphs.Size - glyphs_offset;
+        }
+        else
+        {
+            cache.Glyphs.resize(glyphs_offset);
+            entry->GlyphsOffset = -2;
+        }
+    }
+    if (entry == NULL || entry->GlyphsOffset < 0)
+    {
+        draw_list->AddText(font, font_size, pos, col, text, text_end, wrap_width, cpu_fine_clip_rect);
+        return;
+    }
+
+    IM_ASSERT(font->GetTexID() == draw_list->_TextureIdStack.back());  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+
+    ImVec4 clip_rect = draw_list->_ClipRectStack.back();
+    if (cpu_fine_clip_rect)
+    {
+        clip_rect.x = ImMax(clip_rect.x, cpu_fine_clip_rect->x);
+        clip_rect.y = ImMax(clip_rect.y, cpu_fine_clip_rect->y);
+        clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
+        clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
+    }
+    ImFontRenderLayout(font, draw_list, font_size, pos, col, clip_rect, cache.Glyphs.Data + entry->GlyphsOffset, entry->GlyphsCount, cpu_fine_clip_rect != NULL);
+    cache.GlyphsHits++;
+}
+
+// Called by NewFrame(): rotate the text size cache counters and evict entries which haven't been used for a while.
+void ImGui::UpdateTextSizeCache()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    cache.HitsLastFrame = cache.Hits;
+    cache.MissesLastFrame = cache.Misses;
+    cache.GlyphsHitsLastFrame = cache.GlyphsHits;
+    cache.Hits = cache.Misses = cache.GlyphsHits = 0;
+    if (!g.IO.ConfigTextSizeCache)
+    {
+        if (!cache.Entries.empty())
+            cache.Clear();
+        return;
+    }
+    if ((g.FrameCount % IMGUI_TEXT_SIZE_CACHE_EVICT_FRAMES) != 0 || cache.Entries.empty())
+        return;
+
+    int evict_count = 0;
+    for (int n = 0; n < cache.Entries.Size; n++)
+        if (cache.Entries[n].LastFrameUsed <= g.FrameCount - IMGUI_TEXT_SIZE_CACHE_EVICT_FRAMES)
+            evict_count++;
+    if (evict_count == 0)
+        return;
+
+    // Compact entries along with their text and glyphs, then rebuild the buckets in one go
+    ImVector<char> text_buf;
+    ImVector<ImFontLayoutGlyph> glyphs;
+    int dst_idx = 0;
+    for (int src_idx = 0; src_idx < cache.Entries.Size; src_idx++)
+    {
+        ImGuiTextSizeCacheEntry entry = cache.Entries[src_idx];
+        if (entry.LastFrameUsed <= g.FrameCount - IMGUI_TEXT_SIZE_CACHE_EVICT_FRAMES)
+            continue;
+        text_buf.resize(text_buf.Size + entry.TextLen);
+        memcpy(text_buf.Data + text_buf.Size - entry.TextLen, cache.TextBuf.Data + entry.TextOffset, (size_t)entry.TextLen);
+        entry.TextOffset = text_buf.Size - entry.TextLen;
+        if (entry.GlyphsOffset >= 0)
+        {
+            glyphs.resize(glyphs.Size + entry.GlyphsCount);
+            memcpy(glyphs.Data + glyphs.Size - entry.GlyphsCount, cache.Glyphs.Data + entry.GlyphsOffset, (size_t)entry.GlyphsCount * sizeof(ImFontLayoutGlyph));
+            entry.GlyphsOffset = glyphs.Size - entry.GlyphsCount;
+        }
+        cache.Entries[dst_idx++] = entry;
+    }
+    cache.EvictedTotal += evict_count;
+    cache.Entries.resize(dst_idx);
+    cache.TextBuf.swap(text_buf);
+    cache.Glyphs.swap(glyphs);
+    RebuildTextSizeCacheBuckets(cache, cache.Buckets.Size);
+}
+
+// Return the line index of a large text (io.ConfigTextLineIndex), extended to the bytes appended since the last call.
+// Indices are looked up by address of the text first, then by the hash of its first bytes (so a text buffer moved by a reallocation keeps its index).
+// The bytes before the last indexed line and after the first bytes aren't verified: modifying them in place without shortening the text breaks the index.
+ImGuiTextLineIndex* ImGui::GetTextLineIndex(const char* text, const char* text_end, bool measure_widths)
+{
+    ImGuiContext& g = *GImGui;
+    ImFont* font = g.Font;
+    const int font_build_count = font->ContainerAtlas ? font->ContainerAtlas->BuildCount : 0;
+    const int text_len = (int)(text_end - text);
+    const ImU32 head_hash = ImHashData(text, (size_t)ImMin(text_len, IMGUI_TEXT_LINE_INDEX_CHECK_SIZE), 0);
+
+    // Find an index for this text, and check that the text wasn't modified before the last indexed line
+    ImGuiTextLineIndex* index = NULL;
+    for (int pass = 0; pass < 2 && index == NULL; pass++)
+        for (int n = 0; n < g.TextLineIndices.Size; n++)
+        {
+            ImGuiTextLineIndex* candidate = g.TextLineIndices[n];
+            if (candidate->Font != font || candidate->FontSize != g.FontSize || candidate->FontBuildCount != font_build_count || candidate->MeasureWidths != measure_widths)
+                continue;
+            if (pass == 0 ? (candidate->Text != text) : (candidate->LastFrameUsed == g.FrameCount || candidate->HeadHash != head_hash))
+                continue;
+            index = candidate;
+            break;
+        }
+    if (index != NULL)
+    {
+        const int tail_len = ImMin(index->IndexedEnd, IMGUI_TEXT_LINE_INDEX_CHECK_SIZE);
+        if (text_len < index->IndexedEnd || index->HeadHash != head_hash || index->TailHash != ImHashData(text + index->IndexedEnd - tail_len, (size_t)tail_len, 0))
+            index->Clear();
+    }
+    else
+    {
+        index = IM_NEW(ImGuiTextLineIndex)();
+        index->Font = font;
+        index->FontSize = g.FontSize;
+        index->FontBuildCount = font_build_count;
+        index->MeasureWidths = measure_widths;
+        g.TextLineIndices.push_back(index);
+    }
+    index->Text = text;
+    index->HeadHash = head_hash;
+    index->LastFrameUsed = g.FrameCount;
+
+    // Index new lines. The last line is only indexed once it is terminated, as more text may be appended to it.
+    if (index->LineOffsets.empty())
+        index->LineOffsets.push_back(0);
+    const char* line = text + index->IndexedEnd;
+    while (line < text_end)
+    {
+        const char* line_end = (const char*)memchr(line, '\n', (size_t)(text_end - line));
+        if (!line_end)
+            break;
+        if (measure_widths)
+        {
+            float line_width = font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, line, line_end, NULL).x;
+            index->MaxWidth = ImMax(index->MaxWidth, (float)(int)(line_width + 0.95f)); // Rounded like CalcTextSize()
+        }
+        line = line_end + 1;
+        index->LineOffsets.push_back((int)(line - text));
+    }
+    if (index->IndexedEnd != (int)(line - text))
+    {
+        index->IndexedEnd = (int)(line - text);
+        const int tail_len = ImMin(index->IndexedEnd, IMGUI_TEXT_LINE_INDEX_CHECK_SIZE);
+        index->TailHash = ImHashData(text + index->IndexedEnd - tail_len, (size_t)tail_len, 0);
+    }
+    return index;
+}
+
+// Called by NewFrame(): release the line index of texts which haven't been displayed for a while.
+void ImGui::UpdateTextLineIndices()
+{
+    ImGuiContext& g = *GImGui;
+    for (int n = g.TextLineIndices.Size - 1; n >= 0; n--)
+        if (!g.IO.ConfigTextLineIndex || g.TextLineIndices[n]->LastFrameUsed < g.FrameCount - IMGUI_TEXT_LINE_INDEX_EVICT_FRAMES)
+        {
+            IM_DELETE(g.TextLineIndices[n]);
+            g.TextLineIndices.erase(g.TextLineIndices.Data + n);
+        }
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -4065,10 +5307,88 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
     *out_items_display_end = end;
 }
 
+// Add/remove a window to/from the cells overlapped by a rectangle of the spatial index
+static void AddWindowToSpatialIndexCells(ImGuiWindow* window, const ImRect& r, bool add)
+{
+    ImGuiWindowsSpatialIndex& index = GImGui->WindowsSpatialIndex;
+    if (r.Min.x > r.Max.x || r.Min.y > r.Max.y)
+        return;
+    const int x0 = index.GetCellX(r.Min.x), x1 = index.GetCellX(r.Max.x);
+    const int y0 = index.GetCellY(r.Min.y), y1 = index.GetCellY(r.Max.y);
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++)
+        {
+            ImVector<ImGuiWindow*>& cell = index.Cells[y * index.CellsX + x];
+            if (add)
+            {
+                cell.push_back(window);
+                continue;
+            }
+            int n = 0;
+            while (cell[n] != window)
+                n++;
+            cell.erase_unsorted(cell.Data + n); // Cells are unordered
+        }
+}
+
+// Called by Begin() when OuterRectClipped is updated. Cheap when the window stays within the same cells.
+static void UpdateWindowInSpatialIndex(ImGuiWindow* window)
+{
+    ImGuiWindowsSpatialIndex& index = GImGui->WindowsSpatialIndex;
+    ImRect r = window->OuterRectClipped;
+    r.Expand(index.HitPadding);
+    const ImRect& old_r = window->SpatialIndexRect;
+    const bool old_empty = (old_r.Min.x > old_r.Max.x || old_r.Min.y > old_r.Max.y);
+    const bool new_empty = (r.Min.x > r.Max.x || r.Min.y > r.Max.y);
+    if (old_empty == new_empty && (new_empty || (index.GetCellX(r.Min.x) == index.GetCellX(old_r.Min.x) && index.GetCellX(r.Max.x) == index.GetCellX(old_r.Max.x) &&
+                                                 index.GetCellY(r.Min.y) == index.GetCellY(old_r.Min.y) && index.GetCellY(r.Max.y) == index.GetCellY(old_r.Max.y))))
+    {
+        window->SpatialIndexRect = r;
+        return;
+    }
+    AddWindowToSpatialIndexCells(window, old_r, false);
+    AddWindowToSpatialIndexCells(window, r, true);
+    window->SpatialIndexRect = r;
+}
+
+// Build the spatial index from the current OuterRectClipped of all windows, or release it when io.ConfigWindowsSpatialIndex is cleared
+static void UpdateWindowsSpatialIndex(const ImVec2& hit_padding)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowsSpatialIndex& index = g.WindowsSpatialIndex;
+    if (!g.IO.ConfigWindowsSpatialIndex)
+    {
+        if (index.CellsX > 0)
+        {
+            index.Clear();
+            for (int i = 0; i < g.Windows.Size; i++)
+                g.Windows[i]->SpatialIndexRect = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        }
+        return;
+    }
+
+    const int cells_x = ImMax((int)(g.IO.DisplaySize.x / IMGUI_WINDOWS_SPATIAL_INDEX_CELL_SIZE) + 1, 1);
+    const int cells_y = ImMax((int)(g.IO.DisplaySize.y / IMGUI_WINDOWS_SPATIAL_INDEX_CELL_SIZE) + 1, 1);
+    if (index.CellsX == cells_x && index.CellsY == cells_y && index.HitPadding.x == hit_padding.x && index.HitPadding.y == hit_padding.y)
+        return;
+    index.Clear();
+    index.CellsX = cells_x;
+    index.CellsY = cells_y;
+    index.HitPadding = hit_padding;
+    index.Cells.resize(cells_x * cells_y, ImVector<ImGuiWindow*>());
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        g.Windows[i]->SpatialIndexRect = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        UpdateWindowInSpatialIndex(g.Windows[i]);
+    }
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 // called, aka before the next Begin(). Moving window isn't affected.
+// With io.ConfigWindowsSpatialIndex, only the windows listed in the cell under the mouse are tested, and the front-most one is
+// the one with the highest index in g.Windows. Results are identical.
 static void FindHoveredWindow()
 {
     ImGuiContext& g = *GImGui;
@@ -4079,28 +5399,66 @@ static void FindHoveredWindow()
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS)) : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    UpdateWindowsSpatialIndex(padding_for_resize_from_edges);
+    if (g.IO.ConfigWindowsSpatialIndex)
     {
-        ImGuiWindow* window = g.Windows[i];
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
+        if (hovered_window == NULL && ImGui::IsMousePosValid(&g.IO.MousePos))
+        {
+            const ImGuiWindowsSpatialIndex& index = g.WindowsSpatialIndex;
+            const ImVector<ImGuiWindow*>& cell = index.Cells[index.GetCellY(g.IO.MousePos.y) * index.CellsX + index.GetCellX(g.IO.MousePos.x)];
+            bool display_order_refreshed = false;
+            for (int n = 0; n < cell.Size; n++)
+            {
+                ImGuiWindow* window = cell[n];
+                if (!window->Active || window->Hidden)
+                    continue;
+                if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+                    continue;
+                ImRect bb(window->OuterRectClipped);
+                if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+                    bb.Expand(padding_regular);
+                else
+                    bb.Expand(padding_for_resize_from_edges);
+                if (!bb.Contains(g.IO.MousePos))
+                    continue;
 
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize_from_edges);
-        if (!bb.Contains(g.IO.MousePos))
-            continue;
+                // DisplayOrder is set when sorting windows in EndFrame(), refresh it if windows were reordered since
+                if (!display_order_refreshed && (window->DisplayOrder < 0 || window->DisplayOrder >= g.Windows.Size || g.Windows[window->DisplayOrder] != window))
+                {
+                    for (int i = 0; i < g.Windows.Size; i++)
+                        g.Windows[i]->DisplayOrder = i;
+                    display_order_refreshed = true;
+                }
+                if (hovered_window == NULL || window->DisplayOrder > hovered_window->DisplayOrder)
+                    hovered_window = window;
+            }
+        }
+    }
+    else
+    {
+        for (int i = g.Windows.Size - 1; i >= 0; i--)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            if (!window->Active || window->Hidden)
+                continue;
+            if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+                continue;
 
-        // Those seemingly unnecessary extra tests are because the code here is a little different in viewport/docking branches.
-        if (hovered_window == NULL)
-            hovered_window = window;
-        if (hovered_window)
-            break;
+            // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+            ImRect bb(window->OuterRectClipped);
+            if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+                bb.Expand(padding_regular);
+            else
+                bb.Expand(padding_for_resize_from_edges);
+            if (!bb.Contains(g.IO.MousePos))
+                continue;
+
+            // Those seemingly unnecessary extra tests are because the code here is a little different in viewport/docking branches.
+            if (hovered_window == NULL)
+                hovered_window = window;
+            if (hovered_window)
+                break;
+        }
     }
 
     g.HoveredWindow = hovered_window;
@@ -5462,6 +6820,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // Save clipped aabb so we can access it in constant-time in FindHoveredWindow()
         window->OuterRectClipped = window->Rect();
         window->OuterRectClipped.ClipWith(window->ClipRect);
+        if (g.WindowsSpatialIndex.CellsX > 0)
+            UpdateWindowInSpatialIndex(window);
 
         // Inner rectangle
         // We set this up after processing the resize grip so that our clip rectangle doesn't lag by a frame
@@ -5485,7 +6845,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // Setup draw list and outer clipping rectangle
         window->DrawList->Clear();
         window->DrawList->Flags = (g.Style.AntiAliasedLines ? ImDrawListFlags_AntiAliasedLines : 0) | (g.Style.AntiAliasedFill ? ImDrawListFlags_AntiAliasedFill : 0);
-        window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
+        window->DrawList->PushTextureID(g.Font->GetTexID());
         if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
             PushClipRect(parent_window->ClipRect.Min, parent_window->ClipRect.Max, true);
         else
@@ -5887,6 +7247,7 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(font && font->IsLoaded());    // Font Atlas not created. Did you call io.Fonts->GetTexDataAsRGBA32 / GetTexDataAsAlpha8 ?
     IM_ASSERT(font->Scale > 0.0f);
+    IM_ASSERT((!font->Sdf || font->ContainerAtlas->TexIDSdf != font->ContainerAtlas->TexID) && "Distance field font (ImFontConfig::Sdf) requires a renderer setting ImFontAtlas::TexIDSdf.");
     g.Font = font;
     g.FontBaseSize = ImMax(1.0f, g.IO.FontGlobalScale * g.Font->FontSize * g.Font->Scale);
     g.FontSize = g.CurrentWindow ? g.CurrentWindow->CalcFontSize() : 0.0f;
@@ -5904,7 +7265,7 @@ void ImGui::PushFont(ImFont* font)
         font = GetDefaultFont();
     SetCurrentFont(font);
     g.FontStack.push_back(font);
-    g.CurrentWindow->DrawList->PushTextureID(font->ContainerAtlas->TexID);
+    g.CurrentWindow->DrawList->PushTextureID(font->GetTexID());
 }
 
 void  ImGui::PopFont()
@@ -9651,6 +11012,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+    if (io.BackendFlags & ImGuiBackendFlags_RendererUsesContentSignatures)
+        ImGui::Text("%d draw lists skipped by renderer (unchanged)", io.MetricsRenderListsSkipped);
     ImGui::Separator();
 
     struct Funcs
@@ -9850,6 +11213,44 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::TreePop();
     }
 
+    if (ImGui::TreeNode("TextSizeCache", "Text Size Cache (%d entries)", g.TextSizeCache.Entries.Size))
+    {
+        const ImGuiTextSizeCache& cache = g.TextSizeCache;
+        const int lookups = cache.HitsLastFrame + cache.MissesLastFrame;
+        ImGui::Checkbox("io.ConfigTextSizeCache", &g.IO.ConfigTextSizeCache);
+        ImGui::Text("Last frame: %d hits, %d misses (%.1f%% hit rate), %d texts rendered from cached glyphs", cache.HitsLastFrame, cache.MissesLastFrame, lookups > 0 ? cache.HitsLastFrame * 100.0f / lookups : 0.0f, cache.GlyphsHitsLastFrame);
+        ImGui::Text("Evicted: %d (unused for %d frames)", cache.EvictedTotal, IMGUI_TEXT_SIZE_CACHE_EVICT_FRAMES);
+        ImGui::Text("Memory: %d bytes (%d bytes of text, %d glyphs)", (int)(cache.Entries.capacity() * sizeof(ImGuiTextSizeCacheEntry) + cache.Buckets.capacity() * sizeof(int) + cache.TextBuf.capacity() + cache.Glyphs.capacity() * sizeof(ImFontLayoutGlyph)), cache.TextBuf.Size, cache.Glyphs.Size);
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("TextLineIndices", "Text Line Indices (%d)", g.TextLineIndices.Size))
+    {
+        ImGui::Checkbox("io.ConfigTextLineIndex", &g.IO.ConfigTextLineIndex);
+        for (int n = 0; n < g.TextLineIndices.Size; n++)
+        {
+            const ImGuiTextLineIndex* index = g.TextLineIndices[n];
+            ImGui::BulletText("Text %p: %d lines, %d bytes indexed, max width %.0f, %d bytes, last used frame %d", (const void*)index->Text, index->LineOffsets.Size, index->IndexedEnd, index->MaxWidth, (int)(sizeof(*index) + index->LineOffsets.capacity() * sizeof(int)), index->LastFrameUsed);
+        }
+        ImGui::TreePop();
+    }
+
+    const ImGuiWindowsSpatialIndex& spatial_index = g.WindowsSpatialIndex;
+    if (ImGui::TreeNode("Windows Spatial Index", "Windows Spatial Index (%d x %d cells)", spatial_index.CellsX, spatial_index.CellsY))
+    {
+        ImGui::Checkbox("io.ConfigWindowsSpatialIndex", &g.IO.ConfigWindowsSpatialIndex);
+        int entries = 0, entries_max = 0;
+        for (int n = 0; n < spatial_index.Cells.Size; n++)
+        {
+            entries += spatial_index.Cells[n].Size;
+            entries_max = ImMax(entries_max, spatial_index.Cells[n].Size);
+        }
+        ImGui::BulletText("%d windows listed in cells, up to %d per cell", entries, entries_max);
+        if (spatial_index.CellsX > 0 && ImGui::IsMousePosValid(&g.IO.MousePos))
+            ImGui::BulletText("Mouse cell: (%d,%d), %d windows", spatial_index.GetCellX(g.IO.MousePos.x), spatial_index.GetCellY(g.IO.MousePos.y), spatial_index.Cells[spatial_index.GetCellY(g.IO.MousePos.y) * spatial_index.CellsX + spatial_index.GetCellX(g.IO.MousePos.x)].Size);
+        ImGui::TreePop();
+    }
+
     if (ImGui::TreeNode("Tools"))
     {
         ImGui::Checkbox("Show windows begin order", &show_windows_begin_order);
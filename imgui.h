@@ -99,6 +99,7 @@ struct ImDrawListSharedData;        // Data shared among multiple draw lists (ty
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasPackRect;         // A rectangle to pack into the texture of an ImFontAtlas, used by custom rectangle packers (ImFontAtlas::BuildPackRects)
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
@@ -107,6 +108,8 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store the heights of items of a list, for ImGuiListClipper with items of different heights
+struct ImGuiGridClipper;            // Helper to manually clip large grids of cells along both axes
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
@@ -114,6 +117,7 @@ struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbb][,ccccc]")
+struct ImGuiTextLog;                // Helper to store lines of text and display them with clipping (~debug log/console)
 
 // Typedefs and Enums/Flags (declared as int for compatibility with old C++, to allow using as flags and to not pollute the top of this file)
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
@@ -149,6 +153,8 @@ typedef int ImGuiTreeNodeFlags;     // -> enum ImGuiTreeNodeFlags_   // Flags: f
 typedef int ImGuiWindowFlags;       // -> enum ImGuiWindowFlags_     // Flags: for Begin*()
 typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData *data);
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);
+typedef void (*ImFontAtlasParallelForFunc)(int count, void (*func)(int index, void* func_arg), void* func_arg, void* user_data);
+typedef void (*ImFontAtlasPackRectsFunc)(ImFontAtlasPackRect* rects, int rects_count, int width, int height_max, void* user_data);
 
 // Scalar data types
 typedef signed char         ImS8;   // 8-bit signed integer == char
@@ -1005,7 +1011,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_None                  = 0,
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Back-end supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Back-end supports honoring GetMouseCursor() value to change the OS cursor shape.
-    ImGuiBackendFlags_HasSetMousePos        = 1 << 2    // Back-end supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
+    ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Back-end supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
+    ImGuiBackendFlags_RendererUsesContentSignatures = 1 << 3    // Renderer back-end uses ImDrawList::ContentSignature to skip uploading unchanged lists. Render() will compute signatures.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1309,6 +1316,7 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliasing on lines/borders. Disable if you are really tight on CPU/GPU.
     bool        AntiAliasedFill;            // Enable anti-aliasing on filled shapes (rounded rectangles, circles, etc.)
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
+    float       CircleSegmentMaxError;      // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() without a specific number of segments. Decrease for highly tessellated circles (higher quality, more polygons), increase to reduce quality.
     ImVec4      Colors[ImGuiCol_COUNT];
 
     IMGUI_API ImGuiStyle();
@@ -1354,6 +1362,9 @@ struct ImGuiIO
     bool        ConfigInputTextCursorBlink;     // = true           // Set to false to disable blinking cursor, for users who consider it distracting. (was called: io.OptCursorBlink prior to 1.63)
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
+    bool        ConfigTextSizeCache;            // = false          // [BETA] Cache results of CalcTextSize() and decoded glyphs of rendered text across frames, keyed by font, size, wrap width and text contents. Saves measuring and decoding the same texts every frame. Texts shorter than 32 bytes are not cached (measuring them is as fast). Statistics are displayed in the Metrics window.
+    bool        ConfigTextLineIndex;            // = false          // [BETA] Index the lines of large unwrapped texts passed to TextUnformatted() across frames, so only visible lines are scanned and measured. Text must be append-only: bytes already displayed may only change if the text is moved or shortened (e.g. a log in ImGuiTextBuffer). Appended bytes are indexed incrementally.
+    bool        ConfigWindowsSpatialIndex;      // = false          // [BETA] Find the hovered window with a grid over the display listing the windows overlapping each cell, instead of testing every window. Worth it with hundreds of windows (e.g. child windows used as nodes). Statistics are displayed in the Metrics window.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1423,7 +1434,8 @@ struct ImGuiIO
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
-    int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;       // Number of active allocations, updated (atomically) by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsRenderListsSkipped;      // Number of ImDrawList the renderer back-end didn't upload on its last frame because their content was unchanged (set by back-ends using ImGuiBackendFlags_RendererUsesContentSignatures)
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -1638,6 +1650,55 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Append-only storage for lines of text, displayed with clipping (e.g. a debug log or console with millions of lines)
+// - Text is stored in chunks of 64 KB: appending never moves or copies text already stored, unlike ImGuiTextBuffer.
+// - Each call to Append()/Appendf() adds one or more lines, split on '\n'. The last '\n' is optional: Append("Hello") and Append("Hello\n") are the same.
+// - Set MaxLines to keep only the most recent lines (ring buffer). Chunks only holding dropped lines are reused.
+// - Draw() creates a child window and only submits the visible lines. With a filter, only the lines added since the previous
+//   call are tested (all lines are tested again when the filter changes), so the cost stays proportional to the visible lines.
+//   Those results are stored in the log: use a single filter per log, and call Draw() once per frame.
+struct ImGuiTextLog
+{
+    struct Chunk
+    {
+        char*           Data;
+        int             Size, Capacity;
+    };
+    struct Line
+    {
+        const char*     Begin;
+        int             Len;
+    };
+
+    int                 MaxLines;           // Keep at most that many lines, dropping the oldest ones. 0 for no limit.
+    bool                AutoScroll;         // Draw(): keep scrolling to the last line when it was visible
+    ImVector<Chunk>     Chunks;             // Text storage, oldest first
+    char*               ChunkSpare;         // Last chunk freed by dropping lines, reused for the next chunk
+    ImVector<Line>      Lines;              // Lines[LinesFirst..] are in use, the lines before were dropped (erased in batch)
+    int                 LinesFirst;
+    int                 LineNoFirst;        // Number of lines dropped since Clear(): line_no of Lines[LinesFirst]. Line numbers never change, unlike indices passed to GetLine().
+    ImVector<int>       FilteredLineNos;    // Draw(): Line numbers passing the filter, FilteredLineNos[FilteredFirst..] are in use
+    int                 FilteredFirst;
+    int                 FilteredLineNoEnd;  // Draw(): lines before this number were tested with the filter
+    ImGuiID             FilterHash;         // Draw(): hash of the filter input text used for FilteredLineNos
+    int                 DrawnLineNoFirst;   // Draw(): LineNoFirst on the previous call, to keep the scrolling position on the same lines when the oldest lines are dropped
+
+    IMGUI_API ImGuiTextLog(int max_lines = 0);
+    IMGUI_API ~ImGuiTextLog();
+    IMGUI_API void      Clear();
+    IMGUI_API void      Append(const char* text, const char* text_end = NULL);
+    IMGUI_API void      Appendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void      Appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
+    IMGUI_API void      Draw(const char* str_id, const ImVec2& size = ImVec2(0,0), const ImGuiTextFilter* filter = NULL);
+    int                 GetLinesCount() const   { return Lines.Size - LinesFirst; }
+    const char*         GetLine(int n, const char** out_line_end) const { const Line& line = Lines[LinesFirst + n]; *out_line_end = line.Begin + line.Len; return line.Begin; } // 0 is the oldest line
+
+    // [Internal]
+    IMGUI_API char*     AllocText(int len);
+    IMGUI_API void      AddLines(const char* text, const char* text_end);
+    IMGUI_API void      DropLines();
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -1657,11 +1718,24 @@ struct ImGuiStorage
         Pair(ImGuiID _key, void* _val_p) { key = _key; val_p = _val_p; }
     };
     ImVector<Pair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // With IMGUI_USE_HASHED_STORAGE, Data is a flat open-addressing hash table instead of a sorted array:
+    // - Data[0..HashCapacity-1] are the table slots (unused slots have key==0), Data[HashCapacity] holds the value for key 0.
+    // - Use IsPairUsed() to skip unused slots when iterating Data.
+    int                 HashCapacity;       // Number of table slots, power of two (or 0)
+    int                 HashCount;          // Number of used table slots (key 0 excluded)
+    bool                HashZeroKeyUsed;    // Data[HashCapacity] is in use
+    ImGuiStorage()      { HashCapacity = HashCount = 0; HashZeroKeyUsed = false; }
+    void                Clear() { Data.clear(); HashCapacity = HashCount = 0; HashZeroKeyUsed = false; }
+    bool                IsPairUsed(int n) const { return n < HashCapacity ? Data[n].key != 0 : (n == HashCapacity && HashZeroKeyUsed); }
+#else
+    void                Clear() { Data.clear(); }
+    bool                IsPairUsed(int) const { return true; }
+#endif
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N) (O(1) with IMGUI_USE_HASHED_STORAGE)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1684,6 +1758,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (With IMGUI_USE_HASHED_STORAGE: pairs pushed at the end of Data are inserted into the hash table instead)
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -1700,23 +1775,94 @@ struct ImGuiStorage
 // - Step 1: the clipper infer height from first element, calculate the actual range of elements to display, and position the cursor before the first element.
 // - (Step 2: dummy step only required if an explicit items_height was passed to constructor or Begin() and user call Step(). Does nothing and switch to Step 3.)
 // - Step 3: the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd), advance the cursor to the end of the list and then returns 'false' to end the loop.
+// Items of different heights: pass a ImGuiListClipperHeights instead of items_height, e.g. 'ImGuiListClipper clipper(items_count, &heights)'.
+// Step() then returns one item at a time (DisplayEnd == DisplayStart + 1) and measures its height, until the visible area is filled.
 struct ImGuiListClipper
 {
     float   StartPosY;
     float   ItemsHeight;
     int     ItemsCount, StepNo, DisplayStart, DisplayEnd;
+    ImGuiListClipperHeights* Heights;   // Items of different heights, NULL otherwise
+    float   ItemStartPosY;              // Items of different heights: screen position of the item being displayed, to measure it
+    float   ClipEndPosY;                // Items of different heights: stop after the item crossing this screen position
+    int     AnchorItem;                 // Items of different heights: first item displayed, we keep it at the same position when the heights of the items before it change
+    double  AnchorOffset;
 
     // items_count:  Use -1 to ignore (you can call Begin later). Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step).
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     // If you don't specify an items_height, you NEED to call Step(). If you specify items_height you may call the old Begin()/End() api directly, but prefer calling Step().
     ImGuiListClipper(int items_count = -1, float items_height = -1.0f)  { Begin(items_count, items_height); } // NB: Begin() initialize every fields (as we allow user to call Begin/End multiple times on a same instance if they want).
+    ImGuiListClipper(int items_count, ImGuiListClipperHeights* heights) { Begin(items_count, heights); }
     ~ImGuiListClipper()                                                 { IM_ASSERT(ItemsCount == -1); }      // Assert if user forgot to call End() or Step() until false.
 
     IMGUI_API bool Step();                                              // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
     IMGUI_API void Begin(int items_count, float items_height = -1.0f);  // Automatically called by constructor if you passed 'items_count' or by Step() in Step 1.
+    IMGUI_API void Begin(int items_count, ImGuiListClipperHeights* heights); // Items of different heights. You NEED to call Step().
     IMGUI_API void End();                                               // Automatically called on the last call of Step() that returns false.
 };
 
+// Helper: Heights of the items of a list, for ImGuiListClipper with items of different heights (wrapped text, tree nodes, etc.).
+// - Keep one instance per list across frames, and pass it to ImGuiListClipper every frame.
+// - Heights are measured when the items are displayed. Other items are assumed to have the average measured height, or DefaultHeight.
+//   You can also call SetItemHeight() if you know the heights in advance.
+// - Offsets are stored in a Fenwick tree: finding the first visible item and measuring an item are O(log N), for millions of items.
+// - Items can be added or removed at the end (ImGuiListClipper calls Resize()). Call SetItemHeight(n, -1.0f) when the height of item n
+//   changes, or Clear() when items are inserted/removed in the middle or all heights change (e.g. text wrapped to a new width).
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     ItemHeights;        // Height of each item, < 0.0f when not measured yet
+    ImVector<double>    TreeHeights;        // Fenwick tree of measured heights
+    ImVector<int>       TreeUnmeasured;     // Fenwick tree of the number of unmeasured items
+    double              MeasuredTotal;
+    int                 MeasuredCount;
+    float               DefaultHeight;      // Height of unmeasured items when no item was measured yet. ImGuiListClipper uses GetTextLineHeightWithSpacing() if <= 0.0f.
+
+    ImGuiListClipperHeights(float default_height = -1.0f)   { MeasuredTotal = 0.0; MeasuredCount = 0; DefaultHeight = default_height; }
+    IMGUI_API void      Clear();
+    IMGUI_API void      Resize(int items_count);
+    IMGUI_API void      SetItemHeight(int item_n, float height);    // Use height < 0.0f to forget a measured height
+    float               GetItemHeight(int item_n) const             { return ItemHeights[item_n] >= 0.0f ? ItemHeights[item_n] : GetEstimatedHeight(); }
+    float               GetEstimatedHeight() const                  { return MeasuredCount > 0 ? (float)(MeasuredTotal / MeasuredCount) : DefaultHeight; }
+    double              GetTotalHeight() const                      { return GetItemOffset(ItemHeights.Size); }
+    IMGUI_API double    GetItemOffset(int item_n) const;            // Sum of the heights of items before item_n
+    IMGUI_API int       FindItemAtOffset(double offset) const;      // Item containing 'offset', clamped to [0, items_count]
+};
+
+// Helper: Manually clip large grids of cells (e.g. spreadsheets), along both axes. Horizontal scrolling needs ImGuiWindowFlags_HorizontalScrollbar.
+// - Rows have the same height (cell_size.y), or the heights stored in a ImGuiListClipperHeights. The grid doesn't measure rows: use SetItemHeight().
+// - Columns have the same width (cell_size.x), or the widths of the 'columns_widths' array. Inside a Columns() set, the columns of the set are used.
+// - Sizes are distances between cells, typically including style.ItemSpacing. End() advances the cursor past the grid and declares its whole size.
+// Usage:
+//     ImGuiGridClipper clipper(rows_count, columns_count, ImVec2(100.0f, ImGui::GetTextLineHeightWithSpacing()));
+//     while (clipper.Step())
+//         for (int row = clipper.DisplayRowStart; row < clipper.DisplayRowEnd; row++)
+//             for (int column = clipper.DisplayColumnStart; column < clipper.DisplayColumnEnd; column++)
+//             {
+//                 clipper.SetCursorToCell(row, column);   // Also switches column inside a Columns() set: don't call NextColumn()
+//                 ImGui::Text("%d,%d", row, column);
+//             }
+struct ImGuiGridClipper
+{
+    ImVec2  StartPos;                   // Cursor position of the top-left corner of the grid (same as GetCursorPos())
+    ImVec2  CellSize;
+    int     RowsCount, ColumnsCount, StepNo;
+    int     DisplayRowStart, DisplayRowEnd, DisplayColumnStart, DisplayColumnEnd;
+    ImGuiListClipperHeights* RowsHeights;   // Rows of different heights, NULL otherwise
+    const float* ColumnsWidths;         // Columns of different widths, NULL otherwise
+    bool    InColumnsSet;               // Use the columns of the current Columns() set
+    float   ColumnStartOffsetX;         // Offset of DisplayColumnStart
+    int     CellRow, CellColumn;        // Last cell positioned by SetCursorToCell(), to avoid summing sizes again for the next cell
+    ImVec2  CellOffset;
+
+    ImGuiGridClipper(int rows_count = -1, int columns_count = -1, const ImVec2& cell_size = ImVec2(0, 0), ImGuiListClipperHeights* rows_heights = NULL, const float* columns_widths = NULL) { Begin(rows_count, columns_count, cell_size, rows_heights, columns_widths); }
+    ~ImGuiGridClipper()                 { IM_ASSERT(RowsCount == -1); } // Assert if user forgot to call End() or Step() until false.
+
+    IMGUI_API bool Step();              // Call until it returns false. The DisplayRowXXX/DisplayColumnXXX fields will be set and you can process/draw those cells.
+    IMGUI_API void Begin(int rows_count, int columns_count, const ImVec2& cell_size, ImGuiListClipperHeights* rows_heights = NULL, const float* columns_widths = NULL); // Use rows_count -1 to ignore (you can call Begin later).
+    IMGUI_API void End();               // Automatically called on the last call of Step() that returns false.
+    IMGUI_API void SetCursorToCell(int row, int column);
+};
+
 // Helpers macros to generate 32-bits encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -1864,6 +2010,10 @@ struct ImDrawList
     int                     _ChannelsCount;     // [Internal] number of active channels (1+)
     ImVector<ImDrawChannel> _Channels;          // [Internal] draw channels for columns API (not resized down so _ChannelsCount may be smaller than _Channels.Size)
 
+    // [Optional] Hash of CmdBuffer/IdxBuffer/VtxBuffer contents, computed by Render() when io.BackendFlags has ImGuiBackendFlags_RendererUsesContentSignatures (0 otherwise).
+    // Back-ends may compare it to the signature of the data they last uploaded to skip re-uploading identical geometry.
+    ImU64                   ContentSignature;
+
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; Clear(); }
     ~ImDrawList() { ClearFreeMemory(); }
@@ -1884,8 +2034,8 @@ struct ImDrawList
     IMGUI_API void  AddQuadFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, ImU32 col);
     IMGUI_API void  AddTriangle(const ImVec2& a, const ImVec2& b, const ImVec2& c, ImU32 col, float thickness = 1.0f);
     IMGUI_API void  AddTriangleFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c, ImU32 col);
-    IMGUI_API void  AddCircle(const ImVec2& centre, float radius, ImU32 col, int num_segments = 12, float thickness = 1.0f);
-    IMGUI_API void  AddCircleFilled(const ImVec2& centre, float radius, ImU32 col, int num_segments = 12);
+    IMGUI_API void  AddCircle(const ImVec2& centre, float radius, ImU32 col, int num_segments = 0, float thickness = 1.0f);                                   // num_segments: 0 to calculate from radius and style.CircleSegmentMaxError
+    IMGUI_API void  AddCircleFilled(const ImVec2& centre, float radius, ImU32 col, int num_segments = 0);
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
     IMGUI_API void  AddImage(ImTextureID user_texture_id, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a = ImVec2(0,0), const ImVec2& uv_b = ImVec2(1,1), ImU32 col = IM_COL32_WHITE);
@@ -1895,6 +2045,16 @@ struct ImDrawList
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col); // Note: Anti-aliased filling requires points to be in clockwise order.
     IMGUI_API void  AddBezierCurve(const ImVec2& pos0, const ImVec2& cp0, const ImVec2& cp1, const ImVec2& pos1, ImU32 col, float thickness, int num_segments = 0);
 
+    // Batch primitives
+    // - Same output as calling AddRectFilled() (without rounding), AddLine() or AddCircleFilled() for each element, but buffers are reserved once
+    //   and vertices are written in a single loop. Use for large data sets (scatter plots, heatmaps..).
+    // - Arrays are read with a stride in bytes: pass separate arrays (default strides), or members of an array of structures with stride = sizeof(your struct).
+    //   A stride of 0 uses the same value for all elements (e.g. a single color or radius).
+    // - With 16-bit indices a draw list can only address 64K vertices: split very large data sets or '#define ImDrawIdx unsigned int' in imconfig.h.
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* col, int count, int pos_stride = sizeof(ImVec2), int col_stride = sizeof(ImU32));
+    IMGUI_API void  AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* col, int count, float thickness = 1.0f, int pos_stride = sizeof(ImVec2), int col_stride = sizeof(ImU32));
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centre, const float* radius, const ImU32* col, int count, int num_segments = 0, int pos_stride = sizeof(ImVec2), int radius_stride = sizeof(float), int col_stride = sizeof(ImU32));
+
     // Stateful path API, add points then finish with PathFillConvex() or PathStroke()
     inline    void  PathClear()                                                 { _Path.Size = 0; }
     inline    void  PathLineTo(const ImVec2& pos)                               { _Path.push_back(pos); }
@@ -1913,10 +2073,23 @@ struct ImDrawList
     IMGUI_API void  ChannelsMerge();
     IMGUI_API void  ChannelsSetCurrent(int channel_index);
 
+    // Multi-threaded recording
+    // - Use to generate heavy custom geometry on worker threads: record into separate ImDrawList instances then append them in order.
+    //   The result is identical to submitting the same primitives directly into the parent list (same vertices, indices and draw commands).
+    // - Call ResetForRecording(parent) on each worker list from the parent's thread, before the workers start: it clears the list and copies
+    //   the parent's shared data, flags, and current clip rectangle/texture. Workers may then push/pop clip rectangles and textures but must leave
+    //   the stacks balanced. ImDrawListSharedData (and the font atlas) is only read while recording, so this is safe across threads.
+    //   Exception: with ImFontAtlasFlags_DynamicGlyphs, rendering text may rasterize glyphs into the atlas. Submit text from the parent's thread.
+    //   Lists grow with IM_ALLOC()/IM_FREE() from the worker threads: the functions passed to SetAllocatorFunctions() must be thread-safe (malloc/free are).
+    // - Call AddDrawList(worker) on the parent's thread once the worker is done. Indices are offset, draw commands are merged with the parent's.
+    IMGUI_API void  ResetForRecording(const ImDrawList* parent);
+    IMGUI_API void  AddDrawList(const ImDrawList* src);
+
     // Advanced
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API ImU64 CalcContentSignature() const;                               // Hash CmdBuffer/IdxBuffer/VtxBuffer contents (callbacks are hashed by pointer only, not by what they render). Never returns 0.
 
     // Internal helpers
     // NB: all primitives needs to be reserved via PrimReserve() beforehand!
@@ -1946,11 +2119,12 @@ struct ImDrawData
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    ImU64           ContentSignature;       // [Optional] Combined ImDrawList::ContentSignature of all lists + display parameters, 0 unless signatures are enabled (see ImGuiBackendFlags_RendererUsesContentSignatures). If identical to the last rendered frame, the output is identical and you may skip rendering entirely (unless your callbacks render something different).
 
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); ContentSignature = 0; } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
@@ -1977,6 +2151,8 @@ struct ImFontConfig
     bool            MergeMode;              // false    // Merge into previous ImFont, so you can combine multiple inputs font into one ImFont (e.g. ASCII font + icons + Japanese glyphs). You may want to use GlyphOffset.y when merge font of different heights.
     unsigned int    RasterizerFlags;        // 0x00     // Settings for custom font rasterizer (e.g. ImGuiFreeType). Leave as zero if you aren't using one.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
+    bool            Sdf;                    // false    // Bake glyphs as signed distance fields, so one baked size can be scaled up/down and stay sharp. Requires renderer support (see ImFontAtlas::TexIDSdf). OversampleH/V and RasterizerMultiply are ignored. All sources merged into a font must use the same value.
+    int             SdfSpread;              // 4        // Distance range (in pixels, on each side of the glyph outline) encoded in SDF glyphs. Larger values allow larger scales and effects (outlines, glow) at the cost of atlas space.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -1988,6 +2164,7 @@ struct ImFontConfig
 struct ImFontGlyph
 {
     ImWchar         Codepoint;          // 0x0000..0xFFFF
+    ImU16           DynamicSlot;        // 0 for glyphs baked by Build(), else glyph is rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
     float           U0, V0, U1, V1;     // Texture coordinates
@@ -2008,11 +2185,21 @@ struct ImFontGlyphRangesBuilder
     IMGUI_API void  BuildRanges(ImVector<ImWchar>* out_ranges);                 // Output new ranges
 };
 
+// A rectangle to pack into the font atlas texture. See 'Rectangle packing' below.
+struct ImFontAtlasPackRect
+{
+    int             W, H;               // Input    // Size, including padding
+    int             X, Y;               // Output   // Position of the top-left corner
+    bool            WasPacked;          // Output   // Set to false if the rectangle didn't fit in the (width, height_max) area
+};
+
 enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1    // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 2,   // Only bake Basic Latin + fallback glyphs in Build(), rasterize other glyphs on demand when first rendered. See 'Dynamic glyphs' below.
+    ImFontAtlasFlags_Incremental        = 1 << 3    // Keep the packer after Build() so fonts and custom rectangles added later are packed into the existing texture. See 'Incremental build' below.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2032,6 +2219,27 @@ enum ImFontAtlasFlags_
 //   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed,
 // - Even though many functions are suffixed with "TTF", OTF data is supported just as well.
 // - This is an old API and it is currently awkward for those and and various other reasons! We will address them in the future!
+// Dynamic glyphs (Flags |= ImFontAtlasFlags_DynamicGlyphs), useful with large glyph ranges such as GetGlyphRangesChineseFull():
+//  - Build() only measures the glyphs from your ranges, and rasterizes them into free space of the texture the first time they are rendered.
+//  - The texture has a fixed size of TexDesiredWidth*TexDesiredWidth (1024*1024 if not set). When it is full, least recently used glyphs are evicted.
+//  - The atlas keeps the font data and packing state: don't call ClearInputData() or ClearTexData() after building, or new glyphs will render as the fallback character.
+//  - Your renderer needs to upload the region returned by GetTexDirtyRect() before rendering each frame, then call ClearTexDirtyRect().
+// Incremental build (Flags |= ImFontAtlasFlags_Incremental), to add fonts or font sizes while the application is running:
+//  - AddFont*() doesn't clear the texture data of a built atlas. Call BuildIncremental() after adding fonts or custom rectangles (GetTexData*() does it for you).
+//  - New glyphs and rectangles are packed in the free space of the texture, existing ones are not moved. Only the new rectangles are rasterized.
+//  - TexHeight grows when needed (TexWidth never changes). The UV of existing glyphs are updated, but you need to call CalcCustomRectUV() again.
+//  - Your renderer needs to upload the region returned by GetTexDirtyRect(), recreating its texture if the size changed, then call ClearTexDirtyRect().
+//  - A full Build() is needed to merge new sources (MergeMode) into a font already built, with ImFontAtlasFlags_DynamicGlyphs, or after ClearTexData()/LoadBuiltDataFromXXX().
+// Multi-threaded build (set BuildParallelFor before calling Build() or GetTexData*()):
+//  - Glyphs are measured and packed on the calling thread, then rasterized by jobs writing into separate rectangles of the texture.
+//  - Your function must call func(index, func_arg) for every index in [0, count), possibly on multiple threads, and return only once they have all completed.
+//  - The texture and glyphs are identical to a single-threaded build. Jobs allocate memory: the functions passed to SetAllocatorFunctions() must be thread-safe.
+// Rectangle packing (set BuildPackRects before calling Build() or GetTexData*()):
+//  - By default glyphs are packed with the skyline packer of stb_rect_pack.h, custom rectangles first then one call per font source.
+//  - BuildPackRects is called once with all custom rectangles and glyphs. It must pack them in the (width, height_max) area without overlap.
+//    PackRectsSkyline() and PackRectsShelf() are provided. The shelf packer is faster and often denser with many glyphs of similar sizes (e.g. CJK).
+//  - Not used with ImFontAtlasFlags_DynamicGlyphs and ImFontAtlasFlags_Incremental, which keep the skyline packer alive after Build().
+//  - PackedRectsCount/PackedSurface/PackedHeight report the packing efficiency: PackedSurface / (TexWidth * PackedHeight).
 struct ImFontAtlas
 {
     IMGUI_API ImFontAtlas();
@@ -2053,10 +2261,25 @@ struct ImFontAtlas
     // Building in RGBA32 format is provided for convenience and compatibility, but note that unless you manually manipulate or copy color data into
     // the texture (e.g. when using the AddCustomRect*** api), then the RGB pixels emitted will always be white (~75% of memory/bandwidth waste.
     IMGUI_API bool              Build();                    // Build pixels data. This is called automatically for you by the GetTexData*** functions.
+    IMGUI_API bool              BuildIncremental();         // Build fonts and custom rectangles added since the last build into the existing pixels data. Return false if a full Build() is needed. See 'Incremental build' above.
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt()                   { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
+    IMGUI_API bool              GetTexDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h) const;  // Region of the pixels data modified since the texture was built or since ClearTexDirtyRect(). Return false if unchanged.
+    void                        ClearTexDirtyRect()         { TexDirtyX0 = TexDirtyY0 = TexDirtyX1 = TexDirtyY1 = 0; }
+    IMGUI_API static void       PackRectsSkyline(ImFontAtlasPackRect* rects, int rects_count, int width, int height_max, void* user_data); // Skyline packer of stb_rect_pack.h, sorting rectangles by height
+    IMGUI_API static void       PackRectsShelf(ImFontAtlasPackRect* rects, int rects_count, int width, int height_max, void* user_data);   // Rectangles sorted by height, placed left to right on shelves of similar height
+
+    // Cache the output of Build() to skip rasterizing on the next run: add the same fonts, then call LoadBuiltDataFromXXX() instead of Build().
+    // Loading fails (returns false) when any input changed: font data, ImFontConfig settings, glyph ranges, flags, custom rectangles. Call Build() and SaveBuiltDataToXXX() then.
+    // The data is a flat binary blob in native endianness, copied without parsing: you may memory-map the file yourself and pass the pointer to LoadBuiltDataFromMemory().
+    // Not supported with ImFontAtlasFlags_DynamicGlyphs. Custom rectangles pixels are saved as they are at the time of saving.
+    IMGUI_API ImU32             CalcBuildHash() const;      // Hash of all inputs used by Build(), including the font data.
+    IMGUI_API bool              LoadBuiltDataFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              LoadBuiltDataFromDisk(const char* filename);
+    IMGUI_API bool              SaveBuiltDataToMemory(ImVector<unsigned char>* out_data) const;
+    IMGUI_API bool              SaveBuiltDataToDisk(const char* filename) const;
 
     //-------------------------------------------
     // Glyph Ranges
@@ -2107,8 +2330,13 @@ struct ImFontAtlas
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
+    ImTextureID                 TexIDSdf;           // Texture identifier used instead of TexID when drawing fonts built with ImFontConfig::Sdf. Set by renderers supporting them to a value distinct from TexID, meaning 'same texture, sampled as a distance field'.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    ImFontAtlasParallelForFunc  BuildParallelFor;   // Optional: rasterize glyphs on multiple threads during Build(). NULL by default. See 'Multi-threaded build' above.
+    void*                       BuildParallelForUserData; // Passed as 'user_data' to BuildParallelFor
+    ImFontAtlasPackRectsFunc    BuildPackRects;     // Optional: rectangle packer used by Build(), e.g. ImFontAtlas::PackRectsShelf. NULL by default. See 'Rectangle packing' above.
+    void*                       BuildPackRectsUserData; // Passed as 'user_data' to BuildPackRects
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2122,6 +2350,13 @@ struct ImFontAtlas
     ImVector<CustomRect>        CustomRects;        // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Internal data
     int                         CustomRectIds[1];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
+    int                         TexDirtyX0, TexDirtyY0, TexDirtyX1, TexDirtyY1; // Region of the pixels data modified after Build(), empty when TexDirtyX1 <= TexDirtyX0
+    struct ImFontAtlasDynamicData* DynamicData;     // State kept after Build() to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
+    struct ImFontAtlasIncrementalData* IncrementalData; // State kept after Build() to pack fonts and custom rectangles added later (ImFontAtlasFlags_Incremental)
+    int                         BuildCount;         // Changed every time fonts are built or loaded (unique across atlases), so data derived from font metrics (e.g. the text size cache) can be invalidated
+    int                         PackedRectsCount;   // Number of glyphs and custom rectangles packed into the texture (0 when loaded with LoadBuiltDataFromXXX())
+    int                         PackedSurface;      // Sum of the surface of packed rectangles, including padding
+    int                         PackedHeight;       // Bottom of the lowest packed rectangle. TexHeight is rounded up from it.
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontGlyphRangesBuilder GlyphRangesBuilder; // OBSOLETE 1.67+
@@ -2130,15 +2365,19 @@ struct ImFontAtlas
 
 // Font runtime data and rendering
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
+// The glyph index (IndexAdvanceX, IndexLookup) is split in pages of IM_FONT_INDEX_PAGE_SIZE code-points. Only pages containing glyphs
+// are allocated, except the first one which is always allocated at offset 0 so Basic Latin is looked up without going through IndexPages.
+#define IM_FONT_INDEX_PAGE_SIZE         256
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
+    ImVector<ImU16>             IndexPages;         // 12-16 // out //            // For each page of code-points: offset into IndexAdvanceX/IndexLookup divided by IM_FONT_INDEX_PAGE_SIZE, 0 if not allocated (except page 0). Use GetIndexOffset().
 
     // Members: Hot ~36/48 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Paged. Index glyphs by Unicode code-point.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
     ImVec2                      DisplayOffset;      // 8     // in  // = (0,0)    // Offset font rendering by xx pixels
@@ -2152,15 +2391,17 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        Sdf;                // 1     // out // = false  // Glyphs are signed distance fields (ImFontConfig::Sdf), drawn with ContainerAtlas->TexIDSdf
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { const int index_offset = GetIndexOffset(c); return (index_offset >= 0) ? IndexAdvanceX.Data[index_offset] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
+    ImTextureID                 GetTexID() const                    { return Sdf ? ContainerAtlas->TexIDSdf : ContainerAtlas->TexID; }
 
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
@@ -2173,6 +2414,15 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
     IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API int               AllocIndexOffset(ImWchar c);        // Offset of 'c' into IndexAdvanceX/IndexLookup, allocating its page if needed
+    int                         GetIndexOffset(unsigned int c) const // Offset of 'c' into IndexAdvanceX/IndexLookup, -1 if its page isn't allocated
+    {
+        if (c < IM_FONT_INDEX_PAGE_SIZE)
+            return ((int)c < IndexLookup.Size) ? (int)c : -1;
+        const unsigned int page = c / IM_FONT_INDEX_PAGE_SIZE;
+        const int page_block = (page < (unsigned int)IndexPages.Size) ? (int)IndexPages.Data[page] : 0;
+        return page_block ? page_block * IM_FONT_INDEX_PAGE_SIZE + (int)(c % IM_FONT_INDEX_PAGE_SIZE) : -1;
+    }
     IMGUI_API void              AddGlyph(ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetFallbackChar(ImWchar c);
@@ -337,6 +337,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsResizeFromEdges", &io.ConfigWindowsResizeFromEdges);
             ImGui::SameLine(); HelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
+            ImGui::Checkbox("io.ConfigTextSizeCache", &io.ConfigTextSizeCache);
+            ImGui::SameLine(); HelpMarker("Cache results of CalcTextSize() across frames. Hits and misses are displayed in the Metrics window.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor for you. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
             ImGui::TreePop();
@@ -2542,14 +2544,14 @@ static void ShowDemoWindowColumns()
         ImGui::BeginChild("##ScrollingRegion", ImVec2(0, ImGui::GetFontSize() * 20), false, ImGuiWindowFlags_HorizontalScrollbar);
         ImGui::Columns(10);
         int ITEMS_COUNT = 2000;
-        ImGuiListClipper clipper(ITEMS_COUNT);  // Also demonstrate using the clipper for large list
+        ImGuiGridClipper clipper(ITEMS_COUNT, 10, ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing()));  // Also demonstrate using the clipper for large list, clipping both lines and columns
         while (clipper.Step())
         {
-            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
-                for (int j = 0; j < 10; j++)
+            for (int i = clipper.DisplayRowStart; i < clipper.DisplayRowEnd; i++)
+                for (int j = clipper.DisplayColumnStart; j < clipper.DisplayColumnEnd; j++)
                 {
+                    clipper.SetCursorToCell(i, j); // Replaces NextColumn()
                     ImGui::Text("Line %d Column %d...", i, j);
-                    ImGui::NextColumn();
                 }
         }
         ImGui::Columns(1);
@@ -2854,6 +2856,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigInputTextCursorBlink)                              ImGui::Text("io.ConfigInputTextCursorBlink");
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
+        if (io.ConfigTextSizeCache)                                     ImGui::Text("io.ConfigTextSizeCache");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
@@ -3086,21 +3089,26 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
                     ImGui::Text("Texture surface: %d pixels (approx) ~ %dx%d", font->MetricsTotalSurface, (int)surface_sqrt, (int)surface_sqrt);
                     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
                         if (const ImFontConfig* cfg = &font->ConfigData[config_i])
-                            ImGui::BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d", config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH);
+                            ImGui::BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Sdf: %d", config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->Sdf);
                     if (ImGui::TreeNode("Glyphs", "Glyphs (%d)", font->Glyphs.Size))
                     {
                         // Display all glyphs of the fonts in separate pages of 256 characters
                         for (int base = 0; base < 0x10000; base += 256)
                         {
+                            // (We don't call FindGlyphNoFallback() to count glyphs, as it would rasterize all of them when using ImFontAtlasFlags_DynamicGlyphs)
                             int count = 0;
                             for (int n = 0; n < 256; n++)
-                                count += font->FindGlyphNoFallback((ImWchar)(base + n)) ? 1 : 0;
+                            {
+                                const int index_offset = font->GetIndexOffset((unsigned int)(base + n));
+                                count += (index_offset >= 0 && font->IndexLookup[index_offset] != (ImWchar)-1) ? 1 : 0;
+                            }
                             if (count > 0 && ImGui::TreeNode((void*)(intptr_t)base, "U+%04X..U+%04X (%d %s)", base, base + 255, count, count > 1 ? "glyphs" : "glyph"))
                             {
                                 float cell_size = font->FontSize * 1;
                                 float cell_spacing = style.ItemSpacing.y;
                                 ImVec2 base_pos = ImGui::GetCursorScreenPos();
                                 ImDrawList* draw_list = ImGui::GetWindowDrawList();
+                                draw_list->PushTextureID(font->GetTexID());
                                 for (int n = 0; n < 256; n++)
                                 {
                                     ImVec2 cell_p1(base_pos.x + (n % 16) * (cell_size + cell_spacing), base_pos.y + (n / 16) * (cell_size + cell_spacing));
@@ -3120,6 +3128,7 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
                                         ImGui::EndTooltip();
                                     }
                                 }
+                                draw_list->PopTextureID();
                                 ImGui::Dummy(ImVec2((cell_size + cell_spacing) * 16, (cell_size + cell_spacing) * 16));
                                 ImGui::TreePop();
                             }
@@ -3135,6 +3144,8 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
                 ImVec4 tint_col = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
                 ImVec4 border_col = ImVec4(1.0f, 1.0f, 1.0f, 0.5f);
                 ImGui::Image(atlas->TexID, ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0, 0), ImVec2(1, 1), tint_col, border_col);
+                if (atlas->PackedHeight > 0)
+                    ImGui::Text("%d rectangles packed, using %.1f%% of the %dx%d packed area.", atlas->PackedRectsCount, 100.0f * atlas->PackedSurface / (atlas->TexWidth * atlas->PackedHeight), atlas->TexWidth, atlas->PackedHeight);
                 ImGui::TreePop();
             }
 
@@ -3154,6 +3165,7 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             ImGui::PushItemWidth(100);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, FLT_MAX, "%.2f", 2.0f);
             if (style.CurveTessellationTol < 0.10f) style.CurveTessellationTol = 0.10f;
+            ImGui::DragFloat("Circle Segment Max Error", &style.CircleSegmentMaxError, 0.01f, 0.10f, 10.0f, "%.2f");
             ImGui::DragFloat("Global Alpha", &style.Alpha, 0.005f, 0.20f, 1.0f, "%.2f"); // Not exposing zero here so user doesn't "lose" the UI (zero alpha clips all widgets). But application code could have a toggle to switch between zero and non-zero.
             ImGui::PopItemWidth();
 
@@ -3394,7 +3406,7 @@ struct ExampleAppConsole
         // However, note that you can not use this code as is if a filter is active because it breaks the 'cheap random-access' property. We would need random-access on the post-filtered list.
         // A typical application wanting coarse clipping and filtering may want to pre-compute an array of indices that passed the filtering test, recomputing this array when user changes the filter,
         // and appending newly elements as they are inserted. This is left as a task to the user until we can manage to improve this example code!
-        // If your items are of variable size you may want to implement code similar to what ImGuiListClipper does. Or split your data into fixed height items to allow random-seeking into your list.
+        // If your items are of variable size you can pass a ImGuiListClipperHeights to the clipper, which measures the items it displays (see the "Long text display" example).
         ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4,1)); // Tighten spacing
         if (copy_to_clipboard)
             ImGui::LogToClipboard();
@@ -3605,38 +3617,20 @@ static void ShowExampleAppConsole(bool* p_open)
 //  my_log.Draw("title");
 struct ExampleAppLog
 {
-    ImGuiTextBuffer     Buf;
+    ImGuiTextLog        Log;                // Stores lines in chunks and only submits the visible lines, so we can hold millions of entries
     ImGuiTextFilter     Filter;
-    ImVector<int>       LineOffsets;        // Index to lines offset. We maintain this with AddLog() calls, allowing us to have a random access on lines
-    bool                AutoScroll;
-    bool                ScrollToBottom;
-
-    ExampleAppLog()
-    {
-        AutoScroll = true;
-        ScrollToBottom = false;
-        Clear();
-    }
 
     void    Clear()
     {
-        Buf.clear();
-        LineOffsets.clear();
-        LineOffsets.push_back(0);
+        Log.Clear();
     }
 
     void    AddLog(const char* fmt, ...) IM_FMTARGS(2)
     {
-        int old_size = Buf.size();
         va_list args;
         va_start(args, fmt);
-        Buf.appendfv(fmt, args);
+        Log.Appendfv(fmt, args);
         va_end(args);
-        for (int new_size = Buf.size(); old_size < new_size; old_size++)
-            if (Buf[old_size] == '\n')
-                LineOffsets.push_back(old_size + 1);
-        if (AutoScroll)
-            ScrollToBottom = true;
     }
 
     void    Draw(const char* title, bool* p_open = NULL)
@@ -3650,9 +3644,9 @@ struct ExampleAppLog
         // Options menu
         if (ImGui::BeginPopup("Options"))
         {
-            if (ImGui::Checkbox("Auto-scroll", &AutoScroll))
-                if (AutoScroll)
-                    ScrollToBottom = true;
+            ImGui::Checkbox("Auto-scroll", &Log.AutoScroll);
+            ImGui::SetNextItemWidth(100);
+            ImGui::DragInt("Max lines", &Log.MaxLines, 100.0f, 0, INT_MAX, Log.MaxLines > 0 ? "%d" : "No limit");
             ImGui::EndPopup();
         }
 
@@ -3665,62 +3659,27 @@ struct ExampleAppLog
         bool copy = ImGui::Button("Copy");
         ImGui::SameLine();
         Filter.Draw("Filter", -100.0f);
-
         ImGui::Separator();
-        ImGui::BeginChild("scrolling", ImVec2(0,0), false, ImGuiWindowFlags_HorizontalScrollbar);
 
         if (clear)
             Clear();
         if (copy)
-            ImGui::LogToClipboard();
-
-        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-        const char* buf = Buf.begin();
-        const char* buf_end = Buf.end();
-        if (Filter.IsActive())
         {
-            // In this example we don't use the clipper when Filter is enabled.
-            // This is because we don't have a random access on the result on our filter.
-            // A real application processing logs with ten of thousands of entries may want to store the result of search/filter.
-            // especially if the filtering function is not trivial (e.g. reg-exp).
-            for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
+            // Log.Draw() only submits the visible lines, so we output all lines ourselves.
+            ImGui::LogToClipboard();
+            for (int line_n = 0; line_n < Log.GetLinesCount(); line_n++)
             {
-                const char* line_start = buf + LineOffsets[line_no];
-                const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
+                const char* line_end;
+                const char* line_start = Log.GetLine(line_n, &line_end);
                 if (Filter.PassFilter(line_start, line_end))
-                    ImGui::TextUnformatted(line_start, line_end);
+                    ImGui::LogText("%.*s\n", (int)(line_end - line_start), line_start);
             }
+            ImGui::LogFinish();
         }
-        else
-        {
-            // The simplest and easy way to display the entire buffer:
-            //   ImGui::TextUnformatted(buf_begin, buf_end);
-            // And it'll just work. TextUnformatted() has specialization for large blob of text and will fast-forward to skip non-visible lines.
-            // Here we instead demonstrate using the clipper to only process lines that are within the visible area.
-            // If you have tens of thousands of items and their processing cost is non-negligible, coarse clipping them on your side is recommended.
-            // Using ImGuiListClipper requires A) random access into your data, and B) items all being the  same height,
-            // both of which we can handle since we an array pointing to the beginning of each line of text.
-            // When using the filter (in the block of code above) we don't have random access into the data to display anymore, which is why we don't use the clipper.
-            // Storing or skimming through the search result would make it possible (and would be recommended if you want to search through tens of thousands of entries)
-            ImGuiListClipper clipper;
-            clipper.Begin(LineOffsets.Size);
-            while (clipper.Step())
-            {
-                for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
-                {
-                    const char* line_start = buf + LineOffsets[line_no];
-                    const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                    ImGui::TextUnformatted(line_start, line_end);
-                }
-            }
-            clipper.End();
-        }
-        ImGui::PopStyleVar();
 
-        if (ScrollToBottom)
-            ImGui::SetScrollHereY(1.0f);
-        ScrollToBottom = false;
-        ImGui::EndChild();
+        // ImGuiTextLog::Draw() uses the clipper to only process lines that are within the visible area.
+        // When the filter is active, it stores the line numbers passing the filter and only tests lines added since the last frame.
+        Log.Draw("scrolling", ImVec2(0,0), &Filter);
         ImGui::End();
     }
 };
@@ -3747,6 +3706,10 @@ static void ShowExampleAppLog(bool* p_open)
             counter++;
         }
     }
+    ImGui::SameLine();
+    if (ImGui::SmallButton("[Debug] Add 100000 entries"))
+        for (int n = 0; n < 100000; n++)
+            log.AddLog("[%05d] [info] Entry %d of a large batch\n", ImGui::GetFrameCount(), n);
     ImGui::End();
 
     // Actually call in the regular Log helper (which will Begin() into the same window as we just did)
@@ -3904,7 +3867,7 @@ static void ShowExampleAppLongText(bool* p_open)
     static ImGuiTextBuffer log;
     static int lines = 0;
     ImGui::Text("Printing unusually long amount of text.");
-    ImGui::Combo("Test type", &test_type, "Single call to TextUnformatted()\0Multiple calls to Text(), clipped manually\0Multiple calls to Text(), not clipped (slow)\0");
+    ImGui::Combo("Test type", &test_type, "Single call to TextUnformatted()\0Multiple calls to Text(), clipped manually\0Multiple calls to Text(), not clipped (slow)\0Multiple calls to TextWrapped(), clipped with different heights\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -3939,6 +3902,23 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Wrapped lines of different heights, clipped with the help of ImGuiListClipperHeights, which measures displayed lines.
+            // The heights depend on the wrapping width, so we forget them when it changes.
+            static ImGuiListClipperHeights heights;
+            static float heights_wrap_width = 0.0f;
+            if (heights_wrap_width != ImGui::GetContentRegionAvail().x)
+            {
+                heights.Clear();
+                heights_wrap_width = ImGui::GetContentRegionAvail().x;
+            }
+            ImGuiListClipper clipper(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog%s", i, (i % 3) ? "" : ", then jumps again over the lazy dog, and over the lazy dog once more");
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
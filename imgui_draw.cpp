@@ -347,6 +347,7 @@ ImDrawListSharedData::ImDrawListSharedData()
     Font = NULL;
     FontSize = 0.0f;
     CurveTessellationTol = 0.0f;
+    CircleSegmentMaxError = 0.0f;
     ClipRectFullscreen = ImVec4(-8192.0f, -8192.0f, +8192.0f, +8192.0f);
 
     // Const data
@@ -355,6 +356,44 @@ ImDrawListSharedData::ImDrawListSharedData()
         const float a = ((float)i * 2 * IM_PI) / (float)IM_ARRAYSIZE(CircleVtx12);
         CircleVtx12[i] = ImVec2(ImCos(a), ImSin(a));
     }
+
+    // Same angles as PathArcTo(centre, radius, 0.0f, a_max, num_segments - 1) in AddCircle(), so the output is unchanged
+    CircleVtxTableOffsets[0] = CircleVtxTableOffsets[1] = CircleVtxTableOffsets[2] = 0;
+    for (int num_segments = 3; num_segments <= IM_DRAWLIST_CIRCLE_VTX_TABLE_MAX_SEGMENTS; num_segments++)
+    {
+        CircleVtxTableOffsets[num_segments] = CircleVtxTables.Size;
+        const float a_max = IM_PI*2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
+        for (int i = 0; i < num_segments; i++)
+        {
+            const float a = ((float)i / (float)(num_segments - 1)) * a_max;
+            CircleVtxTables.push_back(ImVec2(ImCos(a), ImSin(a)));
+        }
+    }
+    SetCircleSegmentMaxError(0.30f);
+}
+
+void ImDrawListSharedData::SetCircleSegmentMaxError(float max_error)
+{
+    IM_ASSERT(max_error > 0.0f);
+    if (CircleSegmentMaxError == max_error)
+        return;
+    CircleSegmentMaxError = max_error;
+    for (int i = 0; i < IM_ARRAYSIZE(CircleSegmentCounts); i++)
+    {
+        const float radius = (float)(i + 1);
+        CircleSegmentCounts[i] = (ImU16)IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, CircleSegmentMaxError);
+    }
+}
+
+int ImDrawListSharedData::CalcCircleSegmentCount(float radius) const
+{
+    const float abs_radius = ImFabs(radius);
+    if (abs_radius < (float)IM_ARRAYSIZE(CircleSegmentCounts))
+    {
+        const int radius_idx = (int)ImCeil(abs_radius) - 1;
+        return (radius_idx < 0) ? IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN : CircleSegmentCounts[radius_idx];
+    }
+    return IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(abs_radius, CircleSegmentMaxError);
 }
 
 void ImDrawList::Clear()
@@ -371,6 +410,7 @@ void ImDrawList::Clear()
     _Path.resize(0);
     _ChannelsCurrent = 0;
     _ChannelsCount = 1;
+    ContentSignature = 0;
     // NB: Do not clear channels so our allocations are re-used after the first frame.
 }
 
@@ -387,6 +427,7 @@ void ImDrawList::ClearFreeMemory()
     _Path.clear();
     _ChannelsCurrent = 0;
     _ChannelsCount = 1;
+    ContentSignature = 0;
     for (int i = 0; i < _Channels.Size; i++)
     {
         if (i == 0) memset(&_Channels[0], 0, sizeof(_Channels[0]));  // channel 0 is a copy of CmdBuffer/IdxBuffer, don't destruct again
@@ -403,9 +444,144 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
+    dst->ContentSignature = ContentSignature;
     return dst;
 }
 
+void ImDrawList::ResetForRecording(const ImDrawList* parent)
+{
+    IM_ASSERT(parent != this && parent->CmdBuffer.Size > 0);
+    Clear();
+    _Data = parent->_Data;
+    Flags = parent->Flags;
+    if (parent->_ClipRectStack.Size > 0)
+        _ClipRectStack.push_back(parent->_ClipRectStack.back());
+    if (parent->_TextureIdStack.Size > 0)
+        _TextureIdStack.push_back(parent->_TextureIdStack.back());
+    AddDrawCmd();
+}
+
+// Append the output of 'src' as if its primitives had been submitted to us directly.
+// Only the first command of 'src' needs merging, with the same rules as UpdateClipRect()/UpdateTextureID()/AddCallback(): the following
+// ones were created by 'src' itself in a state that mirrors ours, so they are copied as is.
+void ImDrawList::AddDrawList(const ImDrawList* src)
+{
+    IM_ASSERT(src != this && _Data == src->_Data);
+    IM_ASSERT(src->_ClipRectStack.Size <= 1 && src->_TextureIdStack.Size <= 1 && "Unbalanced PushClipRect()/PushTextureID() in recorded ImDrawList");
+    IM_ASSERT(CmdBuffer.Size > 0 && src->CmdBuffer.Size > 0);
+    if (src->CmdBuffer.Size == 1 && src->CmdBuffer.Data[0].ElemCount == 0 && src->CmdBuffer.Data[0].UserCallback == NULL)
+        return;
+
+    // Vertices are copied as is, indices are offset by our current vertex count
+    const unsigned int vtx_offset = _VtxCurrentIdx;
+    const int vtx_old_size = VtxBuffer.Size;
+    const int idx_old_size = IdxBuffer.Size;
+    VtxBuffer.resize(vtx_old_size + src->VtxBuffer.Size);
+    IdxBuffer.resize(idx_old_size + src->IdxBuffer.Size);
+    if (src->VtxBuffer.Size > 0)
+        memcpy(VtxBuffer.Data + vtx_old_size, src->VtxBuffer.Data, (size_t)src->VtxBuffer.Size * sizeof(ImDrawVert));
+    ImDrawIdx* idx_dst = IdxBuffer.Data + idx_old_size;
+    const ImDrawIdx* idx_src = src->IdxBuffer.Data;
+    for (int idx_n = 0; idx_n < src->IdxBuffer.Size; idx_n++)
+        idx_dst[idx_n] = (ImDrawIdx)(idx_src[idx_n] + vtx_offset);
+    _VtxCurrentIdx += src->_VtxCurrentIdx;
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+
+    // Merge the first command
+    const ImDrawCmd& src_cmd = src->CmdBuffer.Data[0];
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    const bool same_state = (memcmp(&curr_cmd->ClipRect, &src_cmd.ClipRect, sizeof(ImVec4)) == 0 && curr_cmd->TextureId == src_cmd.TextureId);
+    if (curr_cmd->UserCallback != NULL || (curr_cmd->ElemCount != 0 && (src_cmd.UserCallback != NULL || !same_state)))
+    {
+        CmdBuffer.push_back(src_cmd);
+    }
+    else if (src_cmd.UserCallback != NULL)
+    {
+        *curr_cmd = src_cmd;
+    }
+    else
+    {
+        if (curr_cmd->ElemCount == 0 && !same_state)
+        {
+            ImDrawCmd* prev_cmd = CmdBuffer.Size > 1 ? curr_cmd - 1 : NULL;
+            if (prev_cmd && memcmp(&prev_cmd->ClipRect, &src_cmd.ClipRect, sizeof(ImVec4)) == 0 && prev_cmd->TextureId == src_cmd.TextureId && prev_cmd->UserCallback == NULL)
+            {
+                CmdBuffer.pop_back();
+                curr_cmd = prev_cmd;
+            }
+            else
+            {
+                curr_cmd->ClipRect = src_cmd.ClipRect;
+                curr_cmd->TextureId = src_cmd.TextureId;
+            }
+        }
+        curr_cmd->ElemCount += src_cmd.ElemCount;
+    }
+
+    // Copy the following commands
+    const int cmd_old_size = CmdBuffer.Size;
+    CmdBuffer.resize(cmd_old_size + src->CmdBuffer.Size - 1);
+    if (src->CmdBuffer.Size > 1)
+        memcpy(CmdBuffer.Data + cmd_old_size, src->CmdBuffer.Data + 1, (size_t)(src->CmdBuffer.Size - 1) * sizeof(ImDrawCmd));
+}
+
+// 64-bit hash processing 32 bytes per iteration over 4 independent lanes, so it runs close to memory bandwidth.
+// Not a general purpose hash: it only needs to be fast and to make accidental collisions between two frames of geometry unlikely.
+static inline ImU64 ImRotl64(ImU64 v, int r) { return (v << r) | (v >> (64 - r)); }
+static inline ImU64 ImHashMix64(ImU64 h, ImU64 v) { return ImRotl64(h ^ v, 29) * 0x100000001B3ULL; }
+
+static ImU64 ImHashData64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 h0 = seed ^ 0x9E3779B97F4A7C15ULL, h1 = seed ^ 0xC2B2AE3D27D4EB4FULL, h2 = seed ^ 0x165667B19E3779F9ULL, h3 = seed ^ 0x27D4EB2F165667C5ULL;
+    for (; data_size >= 32; data += 32, data_size -= 32)
+    {
+        ImU64 v[4];
+        memcpy(v, data, 32);
+        h0 = ImHashMix64(h0, v[0]);
+        h1 = ImHashMix64(h1, v[1]);
+        h2 = ImHashMix64(h2, v[2]);
+        h3 = ImHashMix64(h3, v[3]);
+    }
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        h0 = ImHashMix64(h0, v);
+    }
+    if (data_size > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, data, data_size);
+        h1 = ImHashMix64(h1, v);
+    }
+    ImU64 h = ImHashMix64(ImHashMix64(ImHashMix64(ImHashMix64(h0, h1), h2), h3), (ImU64)data_size);
+    h ^= h >> 33; h *= 0xFF51AFD7ED558CCDULL; h ^= h >> 33; // Finalizer from MurmurHash3
+    return h;
+}
+
+ImU64 ImDrawList::CalcContentSignature() const
+{
+    ImU64 h = ImHashData64(VtxBuffer.Data, (size_t)VtxBuffer.Size * sizeof(ImDrawVert), 0);
+    h = ImHashData64(IdxBuffer.Data, (size_t)IdxBuffer.Size * sizeof(ImDrawIdx), h);
+
+    // Hash ImDrawCmd fields individually, padding bytes are not guaranteed to be initialized
+    for (int cmd_i = 0; cmd_i < CmdBuffer.Size; cmd_i++)
+    {
+        const ImDrawCmd& cmd = CmdBuffer.Data[cmd_i];
+        ImU64 fields[5];
+        memset(fields, 0, sizeof(fields));
+        fields[0] = cmd.ElemCount;
+        memcpy(&fields[1], &cmd.ClipRect, sizeof(cmd.ClipRect));
+        memcpy(&fields[3], &cmd.UserCallback, sizeof(cmd.UserCallback));
+        memcpy(&fields[4], &cmd.UserCallbackData, sizeof(cmd.UserCallbackData));
+        h = ImHashData64(fields, sizeof(fields), h);
+        h = ImHashData64(&cmd.TextureId, sizeof(cmd.TextureId), h);
+    }
+    return h ? h : 1;
+}
+
 // Using macros because C++ is a terrible language, we want guaranteed inline, no code in header, and no overhead in Debug builds
 #define GetCurrentClipRect()    (_ClipRectStack.Size ? _ClipRectStack.Data[_ClipRectStack.Size-1]  : _Data->ClipRectFullscreen)
 #define GetCurrentTextureId()   (_TextureIdStack.Size ? _TextureIdStack.Data[_TextureIdStack.Size-1] : (ImTextureID)NULL)
@@ -665,6 +841,113 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } }
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; }
 
+// Anti-aliased polylines are tessellated in 3 passes over temporary buffers, the first two have SSE2/NEON paths:
+// - segment normals: normalized (p[i+1] - p[i]) rotated by 90 degrees.
+// - point offsets: average of the two adjacent segment normals, scaled up on sharp angles (IM_FIXNORMAL2F).
+// - vertices: points moved along their offset.
+// The vector paths use the same operations as the scalar code (no reciprocal approximations), so geometry is identical
+// unless the compiler contracts the scalar code into fused multiply-adds, in which case it only differs by rounding.
+static void PolylineComputeNormals(const ImVec2* points, const int points_count, bool closed, ImVec2* out_normals)
+{
+    int i1 = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        const float* p = &points[i1].x;
+        const __m128 d01 = _mm_sub_ps(_mm_loadu_ps(p + 2), _mm_loadu_ps(p + 0));
+        const __m128 d23 = _mm_sub_ps(_mm_loadu_ps(p + 6), _mm_loadu_ps(p + 4));
+        __m128 dx = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 dy = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 over_zero = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_or_ps(_mm_and_ps(over_zero, _mm_div_ps(one, _mm_sqrt_ps(d2))), _mm_andnot_ps(over_zero, one));
+        dx = _mm_xor_ps(_mm_mul_ps(dx, inv_len), sign_mask);
+        dy = _mm_mul_ps(dy, inv_len);
+        _mm_storeu_ps(&out_normals[i1].x, _mm_unpacklo_ps(dy, dx));
+        _mm_storeu_ps(&out_normals[i1 + 2].x, _mm_unpackhi_ps(dy, dx));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        const float32x4x2_t p0 = vld2q_f32(&points[i1].x);
+        const float32x4x2_t p1 = vld2q_f32(&points[i1 + 1].x);
+        float32x4_t dx = vsubq_f32(p1.val[0], p0.val[0]);
+        float32x4_t dy = vsubq_f32(p1.val[1], p0.val[1]);
+        const float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+        const float32x4_t inv_len = vbslq_f32(vcgtq_f32(d2, zero), vdivq_f32(one, vsqrtq_f32(d2)), one);
+        float32x4x2_t n;
+        n.val[0] = vmulq_f32(dy, inv_len);
+        n.val[1] = vnegq_f32(vmulq_f32(dx, inv_len));
+        vst2q_f32(&out_normals[i1].x, n);
+    }
+#endif
+    const int count = closed ? points_count : points_count-1;
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1+1) == points_count ? 0 : i1+1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+    if (!closed)
+        out_normals[points_count-1] = out_normals[points_count-2];
+}
+
+// Offsets for points [1, points_count), the caller sets the offset of point 0 (it depends on the polyline being closed).
+static void PolylineComputeOffsets(const ImVec2* normals, const int points_count, ImVec2* out_offsets)
+{
+    int i = 1;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= points_count; i += 4)
+    {
+        const float* n = &normals[i - 1].x;
+        const __m128 s01 = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(n + 0), _mm_loadu_ps(n + 2)), half);
+        const __m128 s23 = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(n + 4), _mm_loadu_ps(n + 6)), half);
+        const __m128 dm_x = _mm_shuffle_ps(s01, s23, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 dm_y = _mm_shuffle_ps(s01, s23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 d2 = _mm_max_ps(_mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y)), half);
+        const __m128 inv_lensq = _mm_div_ps(one, d2);
+        const __m128 ox = _mm_mul_ps(dm_x, inv_lensq);
+        const __m128 oy = _mm_mul_ps(dm_y, inv_lensq);
+        _mm_storeu_ps(&out_offsets[i].x, _mm_unpacklo_ps(ox, oy));
+        _mm_storeu_ps(&out_offsets[i + 2].x, _mm_unpackhi_ps(ox, oy));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i + 4 <= points_count; i += 4)
+    {
+        const float32x4x2_t n0 = vld2q_f32(&normals[i - 1].x);
+        const float32x4x2_t n1 = vld2q_f32(&normals[i].x);
+        const float32x4_t dm_x = vmulq_f32(vaddq_f32(n0.val[0], n1.val[0]), half);
+        const float32x4_t dm_y = vmulq_f32(vaddq_f32(n0.val[1], n1.val[1]), half);
+        const float32x4_t d2 = vmaxq_f32(vaddq_f32(vmulq_f32(dm_x, dm_x), vmulq_f32(dm_y, dm_y)), half);
+        const float32x4_t inv_lensq = vdivq_f32(one, d2);
+        float32x4x2_t o;
+        o.val[0] = vmulq_f32(dm_x, inv_lensq);
+        o.val[1] = vmulq_f32(dm_y, inv_lensq);
+        vst2q_f32(&out_offsets[i].x, o);
+    }
+#endif
+    for (; i < points_count; i++)
+    {
+        float dm_x = (normals[i - 1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i - 1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_offsets[i].x = dm_x;
+        out_offsets[i].y = dm_y;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
@@ -690,114 +973,38 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * (thick_line ? 5 : 3) * sizeof(ImVec2)); //-V630
-        ImVec2* temp_points = temp_normals + points_count;
-
-        for (int i1 = 0; i1 < count; i1++)
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * 2 * sizeof(ImVec2)); //-V630
+        ImVec2* temp_offsets = temp_normals + points_count;
+        PolylineComputeNormals(points, points_count, closed, temp_normals);
+        PolylineComputeOffsets(temp_normals, points_count, temp_offsets);
+        if (closed)
         {
-            const int i2 = (i1+1) == points_count ? 0 : i1+1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
+            float dm_x = (temp_normals[points_count-1].x + temp_normals[0].x) * 0.5f;
+            float dm_y = (temp_normals[points_count-1].y + temp_normals[0].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            temp_offsets[0] = ImVec2(dm_x, dm_y);
         }
-        if (!closed)
-            temp_normals[points_count-1] = temp_normals[points_count-2];
-
-        if (!thick_line)
+        else
         {
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * AA_SIZE;
-                temp_points[1] = points[0] - temp_normals[0] * AA_SIZE;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * AA_SIZE;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * AA_SIZE;
-            }
+            temp_offsets[0] = temp_normals[0];
+        }
 
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
-            for (int i1 = 0; i1 < count; i1++)
+        // Add indexes
+        const int vtx_stride = thick_line ? 4 : 3;
+        unsigned int idx1 = _VtxCurrentIdx;
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+vtx_stride;
+            if (!thick_line)
             {
-                const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+3;
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y)
-                dm_x *= AA_SIZE;
-                dm_y *= AA_SIZE;
-
-                // Add temporary vertexes
-                ImVec2* out_vtx = &temp_points[i2*2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                // Add indexes
                 _IdxWritePtr[0] = (ImDrawIdx)(idx2+0); _IdxWritePtr[1] = (ImDrawIdx)(idx1+0); _IdxWritePtr[2] = (ImDrawIdx)(idx1+2);
                 _IdxWritePtr[3] = (ImDrawIdx)(idx1+2); _IdxWritePtr[4] = (ImDrawIdx)(idx2+2); _IdxWritePtr[5] = (ImDrawIdx)(idx2+0);
                 _IdxWritePtr[6] = (ImDrawIdx)(idx2+1); _IdxWritePtr[7] = (ImDrawIdx)(idx1+1); _IdxWritePtr[8] = (ImDrawIdx)(idx1+0);
                 _IdxWritePtr[9] = (ImDrawIdx)(idx1+0); _IdxWritePtr[10]= (ImDrawIdx)(idx2+0); _IdxWritePtr[11]= (ImDrawIdx)(idx2+1);
                 _IdxWritePtr += 12;
-
-                idx1 = idx2;
-            }
-
-            // Add vertexes
-            for (int i = 0; i < points_count; i++)
-            {
-                _VtxWritePtr[0].pos = points[i];          _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-                _VtxWritePtr[1].pos = temp_points[i*2+0]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
-                _VtxWritePtr[2].pos = temp_points[i*2+1]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col_trans;
-                _VtxWritePtr += 3;
-            }
-        }
-        else
-        {
-            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[(points_count-1)*4+0] = points[points_count-1] + temp_normals[points_count-1] * (half_inner_thickness + AA_SIZE);
-                temp_points[(points_count-1)*4+1] = points[points_count-1] + temp_normals[points_count-1] * (half_inner_thickness);
-                temp_points[(points_count-1)*4+2] = points[points_count-1] - temp_normals[points_count-1] * (half_inner_thickness);
-                temp_points[(points_count-1)*4+3] = points[points_count-1] - temp_normals[points_count-1] * (half_inner_thickness + AA_SIZE);
             }
-
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
-            for (int i1 = 0; i1 < count; i1++)
+            else
             {
-                const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+4;
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertexes
-                ImVec2* out_vtx = &temp_points[i2*4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1+2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1+2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2+2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2+1);
                 _IdxWritePtr[6]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1+0);
@@ -805,17 +1012,35 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _IdxWritePtr[12] = (ImDrawIdx)(idx2+2); _IdxWritePtr[13] = (ImDrawIdx)(idx1+2); _IdxWritePtr[14] = (ImDrawIdx)(idx1+3);
                 _IdxWritePtr[15] = (ImDrawIdx)(idx1+3); _IdxWritePtr[16] = (ImDrawIdx)(idx2+3); _IdxWritePtr[17] = (ImDrawIdx)(idx2+2);
                 _IdxWritePtr += 18;
-
-                idx1 = idx2;
             }
+            idx1 = idx2;
+        }
 
-            // Add vertexes
+        // Add vertexes
+        if (!thick_line)
+        {
+            for (int i = 0; i < points_count; i++)
+            {
+                const float dm_x = temp_offsets[i].x * AA_SIZE, dm_y = temp_offsets[i].y * AA_SIZE;
+                _VtxWritePtr[0].pos = points[i];                                                          _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos.x = points[i].x + dm_x; _VtxWritePtr[1].pos.y = points[i].y + dm_y;  _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
+                _VtxWritePtr[2].pos.x = points[i].x - dm_x; _VtxWritePtr[2].pos.y = points[i].y - dm_y;  _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col_trans;
+                _VtxWritePtr += 3;
+            }
+        }
+        else
+        {
+            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            const float out_scale = half_inner_thickness + AA_SIZE;
+            const float in_scale = half_inner_thickness;
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i*4+0]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i*4+1]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i*4+2]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i*4+3]; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col_trans;
+                const float dm_out_x = temp_offsets[i].x * out_scale, dm_out_y = temp_offsets[i].y * out_scale;
+                const float dm_in_x = temp_offsets[i].x * in_scale, dm_in_y = temp_offsets[i].y * in_scale;
+                _VtxWritePtr[0].pos.x = points[i].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i].y + dm_out_y; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos.x = points[i].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i].y + dm_in_y;  _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = points[i].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i].y - dm_in_y;  _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = points[i].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i].y - dm_out_y; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
@@ -1142,25 +1367,72 @@ void ImDrawList::AddTriangleFilled(const ImVec2& a, const ImVec2& b, const ImVec
     PathFillConvex(col);
 }
 
+// Unit circle vertices for segment counts which don't have a precomputed table: rotate by a fixed angle,
+// recomputing the exact position every 16 vertices to avoid accumulating errors.
+static void CalcUnitCircleVtx(ImVec2* out_vtx, int num_segments)
+{
+    const float a_max = IM_PI*2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
+    const float a_step = a_max / (float)(num_segments - 1);
+    const float cos_step = ImCos(a_step);
+    const float sin_step = ImSin(a_step);
+    for (int i = 0; i < num_segments; i++)
+    {
+        if ((i & 15) == 0)
+        {
+            const float a = ((float)i / (float)(num_segments - 1)) * a_max;
+            out_vtx[i] = ImVec2(ImCos(a), ImSin(a));
+        }
+        else
+        {
+            const ImVec2 prev = out_vtx[i - 1];
+            out_vtx[i] = ImVec2(prev.x * cos_step - prev.y * sin_step, prev.x * sin_step + prev.y * cos_step);
+        }
+    }
+}
+
+// Closed circle without the overlapping last point: same as PathArcTo(centre, radius, 0.0f, a_max, num_segments - 1) but without per-vertex trigonometry.
+static void PathCircle(ImDrawList* draw_list, const ImVec2& centre, float radius, int num_segments)
+{
+    ImVector<ImVec2>& path = draw_list->_Path;
+    if (radius == 0.0f)
+    {
+        path.push_back(centre);
+        return;
+    }
+    const int path_size = path.Size;
+    path.resize(path_size + num_segments);
+    ImVec2* out_vtx = path.Data + path_size;
+    const ImVec2* unit_circle = draw_list->_Data->GetCircleVtxTable(num_segments);
+    if (unit_circle == NULL)
+    {
+        CalcUnitCircleVtx(out_vtx, num_segments);
+        unit_circle = out_vtx;
+    }
+    for (int i = 0; i < num_segments; i++)
+        out_vtx[i] = ImVec2(centre.x + unit_circle[i].x * radius, centre.y + unit_circle[i].y * radius);
+}
+
 void ImDrawList::AddCircle(const ImVec2& centre, float radius, ImU32 col, int num_segments, float thickness)
 {
+    if (num_segments <= 0)
+        num_segments = _Data->CalcCircleSegmentCount(radius);
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = IM_PI*2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(centre, radius-0.5f, 0.0f, a_max, num_segments - 1);
+    PathCircle(this, centre, radius-0.5f, num_segments);
     PathStroke(col, true, thickness);
 }
 
 void ImDrawList::AddCircleFilled(const ImVec2& centre, float radius, ImU32 col, int num_segments)
 {
+    if (num_segments <= 0)
+        num_segments = _Data->CalcCircleSegmentCount(radius);
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = IM_PI*2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(centre, radius, 0.0f, a_max, num_segments - 1);
+    PathCircle(this, centre, radius, num_segments);
     PathFillConvex(col);
 }
 
@@ -1174,6 +1446,263 @@ void ImDrawList::AddBezierCurve(const ImVec2& pos0, const ImVec2& cp0, const ImV
     PathStroke(col, false, thickness);
 }
 
+// Batch primitives: output is identical to calling AddRectFilled()/AddLine()/AddCircleFilled() for each element, but we reserve
+// the worst case once and write through local pointers. Elements with a zero alpha color are skipped like the single calls do,
+// and the unused part of the reservation is given back at the end.
+#define IM_BATCH_ELEM(TYPE, PTR, STRIDE, N)     (*(const TYPE*)(const void*)((const char*)(PTR) + (size_t)(N) * (size_t)(STRIDE)))
+
+static void ImDrawList_GiveBackUnused(ImDrawList* draw_list, ImDrawVert* vtx_write, ImDrawIdx* idx_write, unsigned int vtx_current_idx)
+{
+    const int idx_expected_size = draw_list->IdxBuffer.Size;
+    draw_list->VtxBuffer.resize((int)(vtx_write - draw_list->VtxBuffer.Data));
+    draw_list->IdxBuffer.resize((int)(idx_write - draw_list->IdxBuffer.Data));
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size-1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_current_idx;
+}
+
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* col, int count, int pos_stride, int col_stride)
+{
+    if (count <= 0)
+        return;
+
+    PrimReserve(count*6, count*4);
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    ImDrawVert* vtx_write = _VtxWritePtr;
+    ImDrawIdx* idx_write = _IdxWritePtr;
+    unsigned int vtx_current_idx = _VtxCurrentIdx;
+    for (int n = 0; n < count; n++)
+    {
+        const ImU32 c = IM_BATCH_ELEM(ImU32, col, col_stride, n);
+        if ((c & IM_COL32_A_MASK) == 0)
+            continue;
+        const ImVec2& a = IM_BATCH_ELEM(ImVec2, p_min, pos_stride, n);
+        const ImVec2& b = IM_BATCH_ELEM(ImVec2, p_max, pos_stride, n);
+        const ImDrawIdx idx = (ImDrawIdx)vtx_current_idx;
+        idx_write[0] = idx; idx_write[1] = (ImDrawIdx)(idx+1); idx_write[2] = (ImDrawIdx)(idx+2);
+        idx_write[3] = idx; idx_write[4] = (ImDrawIdx)(idx+2); idx_write[5] = (ImDrawIdx)(idx+3);
+        vtx_write[0].pos.x = a.x; vtx_write[0].pos.y = a.y; vtx_write[0].uv = uv; vtx_write[0].col = c;
+        vtx_write[1].pos.x = b.x; vtx_write[1].pos.y = a.y; vtx_write[1].uv = uv; vtx_write[1].col = c;
+        vtx_write[2].pos.x = b.x; vtx_write[2].pos.y = b.y; vtx_write[2].uv = uv; vtx_write[2].col = c;
+        vtx_write[3].pos.x = a.x; vtx_write[3].pos.y = b.y; vtx_write[3].uv = uv; vtx_write[3].col = c;
+        vtx_write += 4;
+        idx_write += 6;
+        vtx_current_idx += 4;
+    }
+    ImDrawList_GiveBackUnused(this, vtx_write, idx_write, vtx_current_idx);
+}
+
+// Each line is a 2 points open polyline: this is AddPolyline() unrolled for points_count == 2.
+void ImDrawList::AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* col, int count, float thickness, int pos_stride, int col_stride)
+{
+    if (count <= 0)
+        return;
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const bool thick_line = thickness > 1.0f;
+    const int idx_count = anti_aliased ? (thick_line ? 18 : 12) : 6;
+    const int vtx_count = anti_aliased ? (thick_line ? 8 : 6) : 4;
+    PrimReserve(count*idx_count, count*vtx_count);
+    ImDrawVert* vtx_write = _VtxWritePtr;
+    ImDrawIdx* idx_write = _IdxWritePtr;
+    unsigned int vtx_current_idx = _VtxCurrentIdx;
+
+    const float AA_SIZE = 1.0f;
+    const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+    for (int n = 0; n < count; n++)
+    {
+        const ImU32 c = IM_BATCH_ELEM(ImU32, col, col_stride, n);
+        if ((c & IM_COL32_A_MASK) == 0)
+            continue;
+        const ImVec2& pa = IM_BATCH_ELEM(ImVec2, p1, pos_stride, n);
+        const ImVec2& pb = IM_BATCH_ELEM(ImVec2, p2, pos_stride, n);
+        const float ax = pa.x + 0.5f, ay = pa.y + 0.5f;
+        const float bx = pb.x + 0.5f, by = pb.y + 0.5f;
+        float dx = bx - ax;
+        float dy = by - ay;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        const unsigned int idx = vtx_current_idx;
+
+        if (!anti_aliased)
+        {
+            dx *= (thickness * 0.5f);
+            dy *= (thickness * 0.5f);
+            vtx_write[0].pos.x = ax + dy; vtx_write[0].pos.y = ay - dx; vtx_write[0].uv = uv; vtx_write[0].col = c;
+            vtx_write[1].pos.x = bx + dy; vtx_write[1].pos.y = by - dx; vtx_write[1].uv = uv; vtx_write[1].col = c;
+            vtx_write[2].pos.x = bx - dy; vtx_write[2].pos.y = by + dx; vtx_write[2].uv = uv; vtx_write[2].col = c;
+            vtx_write[3].pos.x = ax - dy; vtx_write[3].pos.y = ay + dx; vtx_write[3].uv = uv; vtx_write[3].col = c;
+            idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx+1); idx_write[2] = (ImDrawIdx)(idx+2);
+            idx_write[3] = (ImDrawIdx)(idx); idx_write[4] = (ImDrawIdx)(idx+2); idx_write[5] = (ImDrawIdx)(idx+3);
+            vtx_write += 4;
+            idx_write += 6;
+            vtx_current_idx += 4;
+            continue;
+        }
+
+        // Start point uses the segment normal, end point uses the (fixed) averaged normal, as in AddPolyline()
+        const ImU32 c_trans = c & ~IM_COL32_A_MASK;
+        const float nx = dy, ny = -dx;
+        float dm_x = (nx + nx) * 0.5f;
+        float dm_y = (ny + ny) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        if (!thick_line)
+        {
+            dm_x *= AA_SIZE;
+            dm_y *= AA_SIZE;
+            vtx_write[0].pos.x = ax;                vtx_write[0].pos.y = ay;                vtx_write[0].uv = uv; vtx_write[0].col = c;
+            vtx_write[1].pos.x = ax + nx * AA_SIZE; vtx_write[1].pos.y = ay + ny * AA_SIZE; vtx_write[1].uv = uv; vtx_write[1].col = c_trans;
+            vtx_write[2].pos.x = ax - nx * AA_SIZE; vtx_write[2].pos.y = ay - ny * AA_SIZE; vtx_write[2].uv = uv; vtx_write[2].col = c_trans;
+            vtx_write[3].pos.x = bx;                vtx_write[3].pos.y = by;                vtx_write[3].uv = uv; vtx_write[3].col = c;
+            vtx_write[4].pos.x = bx + dm_x;         vtx_write[4].pos.y = by + dm_y;         vtx_write[4].uv = uv; vtx_write[4].col = c_trans;
+            vtx_write[5].pos.x = bx - dm_x;         vtx_write[5].pos.y = by - dm_y;         vtx_write[5].uv = uv; vtx_write[5].col = c_trans;
+            idx_write[0] = (ImDrawIdx)(idx+3); idx_write[1] = (ImDrawIdx)(idx+0); idx_write[2] = (ImDrawIdx)(idx+2);
+            idx_write[3] = (ImDrawIdx)(idx+2); idx_write[4] = (ImDrawIdx)(idx+5); idx_write[5] = (ImDrawIdx)(idx+3);
+            idx_write[6] = (ImDrawIdx)(idx+4); idx_write[7] = (ImDrawIdx)(idx+1); idx_write[8] = (ImDrawIdx)(idx+0);
+            idx_write[9] = (ImDrawIdx)(idx+0); idx_write[10]= (ImDrawIdx)(idx+3); idx_write[11]= (ImDrawIdx)(idx+4);
+            vtx_write += 6;
+            idx_write += 12;
+            vtx_current_idx += 6;
+        }
+        else
+        {
+            const float out_scale = half_inner_thickness + AA_SIZE;
+            const float in_scale = half_inner_thickness;
+            const float dm_out_x = dm_x * out_scale, dm_out_y = dm_y * out_scale;
+            const float dm_in_x = dm_x * in_scale, dm_in_y = dm_y * in_scale;
+            vtx_write[0].pos.x = ax + nx * out_scale; vtx_write[0].pos.y = ay + ny * out_scale; vtx_write[0].uv = uv; vtx_write[0].col = c_trans;
+            vtx_write[1].pos.x = ax + nx * in_scale;  vtx_write[1].pos.y = ay + ny * in_scale;  vtx_write[1].uv = uv; vtx_write[1].col = c;
+            vtx_write[2].pos.x = ax - nx * in_scale;  vtx_write[2].pos.y = ay - ny * in_scale;  vtx_write[2].uv = uv; vtx_write[2].col = c;
+            vtx_write[3].pos.x = ax - nx * out_scale; vtx_write[3].pos.y = ay - ny * out_scale; vtx_write[3].uv = uv; vtx_write[3].col = c_trans;
+            vtx_write[4].pos.x = bx + dm_out_x;       vtx_write[4].pos.y = by + dm_out_y;       vtx_write[4].uv = uv; vtx_write[4].col = c_trans;
+            vtx_write[5].pos.x = bx + dm_in_x;        vtx_write[5].pos.y = by + dm_in_y;        vtx_write[5].uv = uv; vtx_write[5].col = c;
+            vtx_write[6].pos.x = bx - dm_in_x;        vtx_write[6].pos.y = by - dm_in_y;        vtx_write[6].uv = uv; vtx_write[6].col = c;
+            vtx_write[7].pos.x = bx - dm_out_x;       vtx_write[7].pos.y = by - dm_out_y;       vtx_write[7].uv = uv; vtx_write[7].col = c_trans;
+            idx_write[0]  = (ImDrawIdx)(idx+5); idx_write[1]  = (ImDrawIdx)(idx+1); idx_write[2]  = (ImDrawIdx)(idx+2);
+            idx_write[3]  = (ImDrawIdx)(idx+2); idx_write[4]  = (ImDrawIdx)(idx+6); idx_write[5]  = (ImDrawIdx)(idx+5);
+            idx_write[6]  = (ImDrawIdx)(idx+5); idx_write[7]  = (ImDrawIdx)(idx+1); idx_write[8]  = (ImDrawIdx)(idx+0);
+            idx_write[9]  = (ImDrawIdx)(idx+0); idx_write[10] = (ImDrawIdx)(idx+4); idx_write[11] = (ImDrawIdx)(idx+5);
+            idx_write[12] = (ImDrawIdx)(idx+6); idx_write[13] = (ImDrawIdx)(idx+2); idx_write[14] = (ImDrawIdx)(idx+3);
+            idx_write[15] = (ImDrawIdx)(idx+3); idx_write[16] = (ImDrawIdx)(idx+7); idx_write[17] = (ImDrawIdx)(idx+6);
+            vtx_write += 8;
+            idx_write += 18;
+            vtx_current_idx += 8;
+        }
+    }
+    ImDrawList_GiveBackUnused(this, vtx_write, idx_write, vtx_current_idx);
+}
+
+// Unit circles come from the shared tables (or are computed once per segment count). Each circle is then filled like AddConvexPolyFilled() would.
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centre, const float* radius, const ImU32* col, int count, int num_segments, int pos_stride, int radius_stride, int col_stride)
+{
+    if (count <= 0 || (num_segments > 0 && num_segments <= 2))
+        return;
+
+    // With automatic segment counts, the reservation needs a first pass over the radii
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    int max_points_count = num_segments;
+    int total_points_count = count * num_segments;
+    if (num_segments <= 0)
+    {
+        total_points_count = 0;
+        for (int n = 0; n < count; n++)
+        {
+            const int points_count = _Data->CalcCircleSegmentCount(IM_BATCH_ELEM(float, radius, radius_stride, n));
+            max_points_count = ImMax(max_points_count, points_count);
+            total_points_count += points_count;
+        }
+    }
+    const int idx_count = anti_aliased ? (total_points_count-2*count)*3 + total_points_count*6 : (total_points_count-2*count)*3;
+    const int vtx_count = anti_aliased ? (total_points_count*2) : total_points_count;
+    PrimReserve(idx_count, vtx_count);
+    ImDrawVert* vtx_write = _VtxWritePtr;
+    ImDrawIdx* idx_write = _IdxWritePtr;
+    unsigned int vtx_current_idx = _VtxCurrentIdx;
+
+    ImVec2* temp_unit_circle = (ImVec2*)alloca(max_points_count * 3 * sizeof(ImVec2)); //-V630
+    ImVec2* points = temp_unit_circle + max_points_count;
+    ImVec2* temp_normals = points + max_points_count;
+    const ImVec2* unit_circle = NULL;
+    int unit_circle_points_count = 0;
+
+    const float AA_SIZE = 1.0f;
+    for (int n = 0; n < count; n++)
+    {
+        const ImU32 c = IM_BATCH_ELEM(ImU32, col, col_stride, n);
+        const float r = IM_BATCH_ELEM(float, radius, radius_stride, n);
+        if ((c & IM_COL32_A_MASK) == 0 || r == 0.0f)
+            continue;
+        const ImVec2& cp = IM_BATCH_ELEM(ImVec2, centre, pos_stride, n);
+        const int points_count = (num_segments > 0) ? num_segments : _Data->CalcCircleSegmentCount(r);
+        if (points_count != unit_circle_points_count)
+        {
+            unit_circle = _Data->GetCircleVtxTable(points_count);
+            if (unit_circle == NULL)
+            {
+                CalcUnitCircleVtx(temp_unit_circle, points_count);
+                unit_circle = temp_unit_circle;
+            }
+            unit_circle_points_count = points_count;
+        }
+        for (int i = 0; i < points_count; i++)
+        {
+            points[i].x = cp.x + unit_circle[i].x * r;
+            points[i].y = cp.y + unit_circle[i].y * r;
+        }
+
+        if (!anti_aliased)
+        {
+            for (int i = 0; i < points_count; i++)
+            {
+                vtx_write[0].pos = points[i]; vtx_write[0].uv = uv; vtx_write[0].col = c;
+                vtx_write++;
+            }
+            for (int i = 2; i < points_count; i++)
+            {
+                idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+i-1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+i);
+                idx_write += 3;
+            }
+            vtx_current_idx += points_count;
+            continue;
+        }
+
+        const ImU32 c_trans = c & ~IM_COL32_A_MASK;
+        const unsigned int vtx_inner_idx = vtx_current_idx;
+        const unsigned int vtx_outer_idx = vtx_current_idx+1;
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx+((i-1)<<1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx+(i<<1));
+            idx_write += 3;
+        }
+        for (int i0 = points_count-1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dx = points[i1].x - points[i0].x;
+            float dy = points[i1].y - points[i0].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i0].x = dy;
+            temp_normals[i0].y = -dx;
+        }
+        for (int i0 = points_count-1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dm_x = (temp_normals[i0].x + temp_normals[i1].x) * 0.5f;
+            float dm_y = (temp_normals[i0].y + temp_normals[i1].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+            vtx_write[0].pos.x = (points[i1].x - dm_x); vtx_write[0].pos.y = (points[i1].y - dm_y); vtx_write[0].uv = uv; vtx_write[0].col = c;        // Inner
+            vtx_write[1].pos.x = (points[i1].x + dm_x); vtx_write[1].pos.y = (points[i1].y + dm_y); vtx_write[1].uv = uv; vtx_write[1].col = c_trans;  // Outer
+            vtx_write += 2;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx+(i1<<1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx+(i0<<1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx+(i0<<1));
+            idx_write[3] = (ImDrawIdx)(vtx_outer_idx+(i0<<1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx+(i1<<1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx+(i1<<1));
+            idx_write += 6;
+        }
+        vtx_current_idx += points_count*2;
+    }
+    ImDrawList_GiveBackUnused(this, vtx_write, idx_write, vtx_current_idx);
+}
+
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1190,7 +1719,7 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
     if (font_size == 0.0f)
         font_size = _Data->FontSize;
 
-    IM_ASSERT(font->ContainerAtlas->TexID == _TextureIdStack.back());  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+    IM_ASSERT(font->GetTexID() == _TextureIdStack.back());  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
 
     ImVec4 clip_rect = _ClipRectStack.back();
     if (cpu_fine_clip_rect)
@@ -1373,6 +1902,8 @@ ImFontConfig::ImFontConfig()
     MergeMode = false;
     RasterizerFlags = 0x00;
     RasterizerMultiply = 1.0f;
+    Sdf = false;
+    SdfSpread = 4;
     memset(Name, 0, sizeof(Name));
     DstFont = NULL;
 }
@@ -1430,13 +1961,78 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(91,0), ImVec2(17,22), ImVec2( 5, 0) }, // ImGuiMouseCursor_Hand
 };
 
+// State kept after Build() to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs).
+// ImFontGlyph::DynamicSlot is either IM_FONTGLYPH_DYNAMIC_NOT_RESIDENT, IM_FONTGLYPH_DYNAMIC_PENDING, IM_FONTGLYPH_DYNAMIC_DROPPED or 1 + index into Slots[].
+#define IM_FONTGLYPH_DYNAMIC_NOT_RESIDENT   0xFFFF      // Not in the texture
+#define IM_FONTGLYPH_DYNAMIC_PENDING        0xFFFE      // Didn't fit in the texture, queued for ImFontAtlasUpdateDynamicGlyphs()
+#define IM_FONTGLYPH_DYNAMIC_DROPPED        0xFFFD      // Didn't fit in the texture even after repacking, the fallback glyph is used until the next Build()
+#define IM_FONTGLYPH_DYNAMIC_SLOTS_MAX      0xFFFC
+
+struct ImFontAtlasDynamicSlot
+{
+    ImFont*             Font;
+    int                 GlyphIndex;         // Index into Font->Glyphs[]
+    int                 LastUsedFrame;
+    stbrp_coord         X, Y, W, H;         // Packed rectangle, including padding
+};
+
+struct ImFontAtlasDynamicData
+{
+    stbrp_context                       PackContext;        // Live packer, with the baked glyphs and the resident dynamic glyphs
+    ImVector<stbrp_node>                PackNodes;
+    stbrp_context                       PackContextBaked;   // Copy of the packer state after Build(), before any dynamic glyph was added
+    ImVector<stbrp_node>                PackNodesBaked;
+    ImVector<stbtt_fontinfo>            FontInfos;          // Parallel to atlas->ConfigData[]
+    ImVector<ImFontAtlasDynamicSlot>    Slots;              // Resident glyphs
+    ImVector<ImFontAtlasDynamicSlot>    Pending;            // Glyphs which didn't fit this frame (only Font and GlyphIndex are used)
+    int                                 FrameCount;
+    ImFontAtlasDynamicStats             Stats;
+
+    ImFontAtlasDynamicData()            { memset(&PackContext, 0, sizeof(PackContext)); memset(&PackContextBaked, 0, sizeof(PackContextBaked)); FrameCount = 0; }
+};
+
+static void ImFontAtlasDynamicDestroy(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicData)
+        IM_DELETE(atlas->DynamicData);
+    atlas->DynamicData = NULL;
+}
+
+// With ImFontAtlasFlags_Incremental, the packer used by Build() is kept alive so BuildIncremental() can pack new rectangles into the free space.
+// The packer is initialized with the maximum texture height, TexHeight only covers the rectangles packed so far (PackedHeight) rounded up.
+struct ImFontAtlasIncrementalData
+{
+    stbrp_context                       PackContext;
+    ImVector<stbrp_node>                PackNodes;
+    int                                 PackedHeight;       // Bottom of the lowest packed rectangle
+    int                                 ConfigDataBuilt;    // Number of atlas->ConfigData[] entries built into the texture
+    int                                 CustomRectsBuilt;   // Number of atlas->CustomRects[] entries packed into the texture
+
+    ImFontAtlasIncrementalData()        { memset(&PackContext, 0, sizeof(PackContext)); PackedHeight = ConfigDataBuilt = CustomRectsBuilt = 0; }
+};
+
+static void ImFontAtlasIncrementalDestroy(ImFontAtlas* atlas)
+{
+    if (atlas->IncrementalData)
+        IM_DELETE(atlas->IncrementalData);
+    atlas->IncrementalData = NULL;
+}
+
+// Source of ImFontAtlas::BuildCount values, unique across atlases: an atlas allocated at the address of a destroyed one never matches data derived from the old fonts.
+static int GImFontAtlasBuildCounter = 0;
+
 ImFontAtlas::ImFontAtlas()
 {
     Locked = false;
     Flags = ImFontAtlasFlags_None;
     TexID = (ImTextureID)NULL;
+    TexIDSdf = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    BuildParallelFor = NULL;
+    BuildParallelForUserData = NULL;
+    BuildPackRects = NULL;
+    BuildPackRectsUserData = NULL;
 
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
@@ -1445,6 +2041,11 @@ ImFontAtlas::ImFontAtlas()
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
+    TexDirtyX0 = TexDirtyY0 = TexDirtyX1 = TexDirtyY1 = 0;
+    DynamicData = NULL;
+    IncrementalData = NULL;
+    BuildCount = 0;
+    PackedRectsCount = PackedSurface = PackedHeight = 0;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1456,6 +2057,8 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicDestroy(this);    // Refers to font data
+    ImFontAtlasIncrementalDestroy(this);
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -1479,17 +2082,22 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicDestroy(this);    // Rasterizes into pixels data
+    ImFontAtlasIncrementalDestroy(this);
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
         IM_FREE(TexPixelsRGBA32);
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
+    PackedRectsCount = PackedSurface = PackedHeight = 0;
 }
 
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicDestroy(this);    // Refers to fonts
+    ImFontAtlasIncrementalDestroy(this);
     for (int i = 0; i < Fonts.Size; i++)
         IM_DELETE(Fonts[i]);
     Fonts.clear();
@@ -1511,6 +2119,11 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
             AddFontDefault();
         Build();
     }
+    else if (IncrementalData && (IncrementalData->ConfigDataBuilt < ConfigData.Size || IncrementalData->CustomRectsBuilt < CustomRects.Size))
+    {
+        if (!BuildIncremental())
+            Build();
+    }
 
     *out_pixels = TexPixelsAlpha8;
     if (out_width) *out_width = TexWidth;
@@ -1542,17 +2155,375 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
     if (out_bytes_per_pixel) *out_bytes_per_pixel = 4;
 }
 
-ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
+bool    ImFontAtlas::GetTexDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h) const
 {
-    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
-    IM_ASSERT(font_cfg->SizePixels > 0.0f);
+    if (TexDirtyX1 <= TexDirtyX0)
+        return false;
+    *out_x = TexDirtyX0;
+    *out_y = TexDirtyY0;
+    *out_w = TexDirtyX1 - TexDirtyX0;
+    *out_h = TexDirtyY1 - TexDirtyY0;
+    return true;
+}
 
-    // Create new font
-    if (!font_cfg->MergeMode)
-        Fonts.push_back(IM_NEW(ImFont));
-    else
-        IM_ASSERT(!Fonts.empty() && "Cannot use MergeMode for the first font"); // When using MergeMode make sure that a font has already been added before. You can use ImGui::GetIO().Fonts->AddFontDefault() to add the default imgui font.
+// Built data cache: see LoadBuiltDataFromMemory()/SaveBuiltDataToMemory().
+// Layout written by SaveBuiltDataToMemory(), in native endianness, every section starting on a 4-byte boundary:
+//   ImFontAtlasBuiltDataHeader
+//   ImFontAtlasBuiltDataRect[CustomRectsCount]
+//   For each font: ImFontAtlasBuiltDataFont, ImFontGlyph[GlyphsCount], float IndexAdvanceX[IndexSize], ImWchar IndexLookup[IndexSize], ImU16 IndexPages[IndexPagesCount]
+//   unsigned char TexPixelsAlpha8[TexWidth * TexHeight]
+#define IM_FONTATLAS_BUILT_DATA_MAGIC       0x41464D49  // "IMFA"
+#define IM_FONTATLAS_BUILT_DATA_VERSION     3
+
+struct ImFontAtlasBuiltDataHeader
+{
+    ImU32       Magic;
+    ImU32       Version;                // IM_FONTATLAS_BUILT_DATA_VERSION
+    ImU32       ImGuiVersion;           // IMGUI_VERSION_NUM
+    ImU32       StructSizes;            // Detect layout changes in the structures we copy as is
+    ImU32       BuildHash;              // CalcBuildHash() of the atlas which saved the data
+    ImU32       DataSize;               // Total size, including this header
+    int         TexWidth, TexHeight;
+    ImVec2      TexUvWhitePixel;
+    int         CustomRectIds[1];       // Same as ImFontAtlas::CustomRectIds[]
+    int         CustomRectsCount;
+    int         FontsCount;
+};
+IM_STATIC_ASSERT(sizeof(((ImFontAtlasBuiltDataHeader*)0)->CustomRectIds) == sizeof(((ImFontAtlas*)0)->CustomRectIds));
+
+struct ImFontAtlasBuiltDataRect
+{
+    ImU32       ID;
+    ImU16       Width, Height;
+    ImU16       X, Y;
+    float       GlyphAdvanceX;
+    ImVec2      GlyphOffset;
+    int         FontIndex;              // Index into Fonts[], -1 if none
+};
+
+struct ImFontAtlasBuiltDataFont
+{
+    float       FontSize;
+    float       Ascent, Descent;
+    float       FallbackAdvanceX;
+    int         MetricsTotalSurface;
+    int         ConfigDataIndex;        // Index into ConfigData[], -1 if none
+    int         ConfigDataCount;
+    int         IsLoaded;               // ContainerAtlas != NULL
+    int         Sdf;
+    int         GlyphsCount;
+    int         IndexSize;
+    int         IndexPagesCount;
+    int         FallbackGlyphIndex;     // Index into Glyphs[], -1 if none
+};
+
+static ImU32 ImFontAtlasBuiltDataStructSizes()
+{
+    return (ImU32)sizeof(ImWchar) | ((ImU32)sizeof(ImFontGlyph) << 8) | ((ImU32)sizeof(ImFontAtlasBuiltDataFont) << 16) | ((ImU32)sizeof(ImFontAtlasBuiltDataRect) << 24);
+}
+
+static int ImFontAtlasFindFontIndex(const ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+        if (atlas->Fonts[n] == font)
+            return n;
+    return -1;
+}
+
+static void ImFontAtlasBuiltDataWrite(ImVector<unsigned char>* out_data, const void* data, size_t data_size)
+{
+    const int offset = out_data->Size;
+    const int data_size_aligned = ((int)data_size + 3) & ~3;
+    out_data->resize(offset + data_size_aligned);
+    if (data_size > 0)
+        memcpy(out_data->Data + offset, data, data_size);
+    memset(out_data->Data + offset + data_size, 0, (size_t)data_size_aligned - data_size);
+}
+
+static const void* ImFontAtlasBuiltDataRead(const unsigned char** p, const unsigned char* p_end, size_t data_size)
+{
+    const size_t data_size_aligned = (data_size + 3) & ~(size_t)3;
+    if ((size_t)(p_end - *p) < data_size_aligned)
+        return NULL;
+    const void* data = *p;
+    *p += data_size_aligned;
+    return data;
+}
+
+// Hash every input used by Build(): font data and settings, glyph ranges, fallback characters, flags and custom rectangles.
+ImU32   ImFontAtlas::CalcBuildHash() const
+{
+    ImU32 hash = ImHashData(&Flags, sizeof(Flags), IM_FONTATLAS_BUILT_DATA_VERSION);
+    hash = ImHashData(&TexDesiredWidth, sizeof(TexDesiredWidth), hash);
+    hash = ImHashData(&TexGlyphPadding, sizeof(TexGlyphPadding), hash);
+    for (int cfg_i = 0; cfg_i < ConfigData.Size; cfg_i++)
+    {
+        const ImFontConfig& cfg = ConfigData[cfg_i];
+        if (cfg.FontData)
+            hash = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, hash);
+        const int settings_i[] = { cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.RasterizerFlags, cfg.Sdf, cfg.SdfSpread, ImFontAtlasFindFontIndex(this, cfg.DstFont) };
+        const float settings_f[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+        hash = ImHashData(settings_i, sizeof(settings_i), hash);
+        hash = ImHashData(settings_f, sizeof(settings_f), hash);
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : const_cast<ImFontAtlas*>(this)->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] && ranges[ranges_count + 1])
+            ranges_count += 2;
+        hash = ImHashData(ranges, sizeof(ImWchar) * (size_t)ranges_count, hash);
+    }
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+        hash = ImHashData(&Fonts[font_i]->FallbackChar, sizeof(ImWchar), hash);
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        // Skip our own rectangle, which is only registered by Build()
+        const CustomRect& r = CustomRects[rect_i];
+        if (r.ID == FONT_ATLAS_DEFAULT_TEX_DATA_ID)
+            continue;
+        const int rect_settings_i[] = { (int)r.ID, r.Width, r.Height, ImFontAtlasFindFontIndex(this, r.Font) };
+        const float rect_settings_f[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        hash = ImHashData(rect_settings_i, sizeof(rect_settings_i), hash);
+        hash = ImHashData(rect_settings_f, sizeof(rect_settings_f), hash);
+    }
+    return hash;
+}
+
+// Restore the output of a previous Build() saved with SaveBuiltDataToMemory(). Return false if the data doesn't match the current inputs.
+bool    ImFontAtlas::LoadBuiltDataFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuiltDataHeader header;
+    if (data == NULL || data_size < sizeof(header) || ConfigData.empty() || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.Magic != IM_FONTATLAS_BUILT_DATA_MAGIC || header.Version != IM_FONTATLAS_BUILT_DATA_VERSION || header.ImGuiVersion != IMGUI_VERSION_NUM || header.StructSizes != ImFontAtlasBuiltDataStructSizes())
+        return false;
+    if (header.DataSize != data_size || header.FontsCount != Fonts.Size || header.CustomRectsCount < 0 || header.TexWidth <= 0 || header.TexHeight <= 0)
+        return false;
+    if (header.BuildHash != CalcBuildHash())
+        return false;
+    for (int n = 0; n < IM_ARRAYSIZE(header.CustomRectIds); n++)
+        if (header.CustomRectIds[n] < -1 || header.CustomRectIds[n] >= header.CustomRectsCount)
+            return false;
+
+    // Locate and validate every section before modifying the atlas
+    const unsigned char* p = (const unsigned char*)data + sizeof(header);
+    const unsigned char* p_end = (const unsigned char*)data + data_size;
+    const ImFontAtlasBuiltDataRect* rects = (const ImFontAtlasBuiltDataRect*)ImFontAtlasBuiltDataRead(&p, p_end, sizeof(ImFontAtlasBuiltDataRect) * (size_t)header.CustomRectsCount);
+    if (rects == NULL)
+        return false;
+    for (int rect_i = 0; rect_i < header.CustomRectsCount; rect_i++)
+        if (rects[rect_i].FontIndex >= Fonts.Size)
+            return false;
+    ImVector<const unsigned char*> fonts_data;
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        fonts_data.push_back(p);
+        ImFontAtlasBuiltDataFont font_header;
+        const void* font_header_data = ImFontAtlasBuiltDataRead(&p, p_end, sizeof(font_header));
+        if (font_header_data == NULL)
+            return false;
+        memcpy(&font_header, font_header_data, sizeof(font_header));
+        if (font_header.GlyphsCount < 0 || font_header.GlyphsCount >= 0xFFFF || font_header.IndexSize < 0 || font_header.IndexSize > 0x10000 || (font_header.IndexSize % IM_FONT_INDEX_PAGE_SIZE) != 0)
+            return false;
+        if (font_header.IndexPagesCount < 0 || font_header.IndexPagesCount > 0x10000 / IM_FONT_INDEX_PAGE_SIZE)
+            return false;
+        if (font_header.ConfigDataIndex >= ConfigData.Size || font_header.FallbackGlyphIndex >= font_header.GlyphsCount)
+            return false;
+        const ImFontGlyph* glyphs = (const ImFontGlyph*)ImFontAtlasBuiltDataRead(&p, p_end, sizeof(ImFontGlyph) * (size_t)font_header.GlyphsCount);
+        const float* index_advance_x = (const float*)ImFontAtlasBuiltDataRead(&p, p_end, sizeof(float) * (size_t)font_header.IndexSize);
+        const ImWchar* index_lookup = (const ImWchar*)ImFontAtlasBuiltDataRead(&p, p_end, sizeof(ImWchar) * (size_t)font_header.IndexSize);
+        const ImU16* index_pages = (const ImU16*)ImFontAtlasBuiltDataRead(&p, p_end, sizeof(ImU16) * (size_t)font_header.IndexPagesCount);
+        if (glyphs == NULL || index_advance_x == NULL || index_lookup == NULL || index_pages == NULL)
+            return false;
+        for (int page = 0; page < font_header.IndexPagesCount; page++)
+            if (index_pages[page] >= font_header.IndexSize / IM_FONT_INDEX_PAGE_SIZE)
+                return false;
+        for (int glyph_i = 0; glyph_i < font_header.GlyphsCount; glyph_i++)
+            if (glyphs[glyph_i].DynamicSlot != 0)
+                return false;
+        for (int n = 0; n < font_header.IndexSize; n++)
+            if (index_lookup[n] != (ImWchar)-1 && index_lookup[n] >= font_header.GlyphsCount)
+                return false;
+    }
+    const unsigned char* pixels = (const unsigned char*)ImFontAtlasBuiltDataRead(&p, p_end, (size_t)header.TexWidth * (size_t)header.TexHeight);
+    if (pixels == NULL || p != p_end)
+        return false;
+
+    // Texture
+    ClearTexData();
+    ClearTexDirtyRect();
+    TexID = TexIDSdf = (ImTextureID)NULL;
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = header.TexUvWhitePixel;
+    TexPixelsAlpha8 = (unsigned char*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight);
+    memcpy(TexPixelsAlpha8, pixels, (size_t)TexWidth * (size_t)TexHeight);
+
+    // Custom rectangles, including the ones registered by Build()
+    memcpy(CustomRectIds, header.CustomRectIds, sizeof(CustomRectIds));
+    CustomRects.resize(header.CustomRectsCount);
+    for (int rect_i = 0; rect_i < header.CustomRectsCount; rect_i++)
+    {
+        const ImFontAtlasBuiltDataRect& src = rects[rect_i];
+        CustomRect& r = CustomRects[rect_i];
+        r.ID = src.ID;
+        r.Width = src.Width;
+        r.Height = src.Height;
+        r.X = src.X;
+        r.Y = src.Y;
+        r.GlyphAdvanceX = src.GlyphAdvanceX;
+        r.GlyphOffset = src.GlyphOffset;
+        r.Font = (src.FontIndex >= 0) ? Fonts[src.FontIndex] : NULL;
+    }
+
+    // Fonts
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        const unsigned char* font_p = fonts_data[font_i];
+        ImFontAtlasBuiltDataFont font_header;
+        memcpy(&font_header, ImFontAtlasBuiltDataRead(&font_p, p_end, sizeof(font_header)), sizeof(font_header));
+        const void* glyphs = ImFontAtlasBuiltDataRead(&font_p, p_end, sizeof(ImFontGlyph) * (size_t)font_header.GlyphsCount);
+        const void* index_advance_x = ImFontAtlasBuiltDataRead(&font_p, p_end, sizeof(float) * (size_t)font_header.IndexSize);
+        const void* index_lookup = ImFontAtlasBuiltDataRead(&font_p, p_end, sizeof(ImWchar) * (size_t)font_header.IndexSize);
+        const void* index_pages = ImFontAtlasBuiltDataRead(&font_p, p_end, sizeof(ImU16) * (size_t)font_header.IndexPagesCount);
+
+        ImFont* font = Fonts[font_i];
+        font->ClearOutputData();
+        font->FontSize = font_header.FontSize;
+        font->Ascent = font_header.Ascent;
+        font->Descent = font_header.Descent;
+        font->FallbackAdvanceX = font_header.FallbackAdvanceX;
+        font->MetricsTotalSurface = font_header.MetricsTotalSurface;
+        font->ConfigData = (font_header.ConfigDataIndex >= 0) ? &ConfigData[font_header.ConfigDataIndex] : NULL;
+        font->ConfigDataCount = (short)font_header.ConfigDataCount;
+        font->ContainerAtlas = font_header.IsLoaded ? this : NULL;
+        font->Sdf = (font_header.Sdf != 0);
+        font->Glyphs.resize(font_header.GlyphsCount);
+        font->IndexAdvanceX.resize(font_header.IndexSize);
+        font->IndexLookup.resize(font_header.IndexSize);
+        font->IndexPages.resize(font_header.IndexPagesCount);
+        if (font_header.GlyphsCount > 0)
+            memcpy(font->Glyphs.Data, glyphs, (size_t)font->Glyphs.size_in_bytes());
+        if (font_header.IndexSize > 0)
+        {
+            memcpy(font->IndexAdvanceX.Data, index_advance_x, (size_t)font->IndexAdvanceX.size_in_bytes());
+            memcpy(font->IndexLookup.Data, index_lookup, (size_t)font->IndexLookup.size_in_bytes());
+        }
+        if (font_header.IndexPagesCount > 0)
+            memcpy(font->IndexPages.Data, index_pages, (size_t)font->IndexPages.size_in_bytes());
+        font->FallbackGlyph = (font_header.FallbackGlyphIndex >= 0) ? &font->Glyphs[font_header.FallbackGlyphIndex] : NULL;
+        font->DirtyLookupTables = false;
+    }
+    BuildCount = ImAtomicAdd(&GImFontAtlasBuildCounter, 1) + 1;
+    return true;
+}
+
+bool    ImFontAtlas::LoadBuiltDataFromDisk(const char* filename)
+{
+    size_t file_data_size = 0;
+    void* file_data = ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (!file_data)
+        return false;
+    const bool ret = LoadBuiltDataFromMemory(file_data, file_data_size);
+    IM_FREE(file_data);
+    return ret;
+}
+
+// Serialize the output of Build(). Return false if the atlas isn't built or uses ImFontAtlasFlags_DynamicGlyphs.
+bool    ImFontAtlas::SaveBuiltDataToMemory(ImVector<unsigned char>* out_data) const
+{
+    out_data->resize(0);
+    if (TexPixelsAlpha8 == NULL || DynamicData != NULL || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return false;
+
+    ImFontAtlasBuiltDataHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IM_FONTATLAS_BUILT_DATA_MAGIC;
+    header.Version = IM_FONTATLAS_BUILT_DATA_VERSION;
+    header.ImGuiVersion = IMGUI_VERSION_NUM;
+    header.StructSizes = ImFontAtlasBuiltDataStructSizes();
+    header.BuildHash = CalcBuildHash();
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    memcpy(header.CustomRectIds, CustomRectIds, sizeof(CustomRectIds));
+    header.CustomRectsCount = CustomRects.Size;
+    header.FontsCount = Fonts.Size;
+    ImFontAtlasBuiltDataWrite(out_data, &header, sizeof(header));
+
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        const CustomRect& r = CustomRects[rect_i];
+        ImFontAtlasBuiltDataRect dst;
+        memset(&dst, 0, sizeof(dst));
+        dst.ID = r.ID;
+        dst.Width = r.Width;
+        dst.Height = r.Height;
+        dst.X = r.X;
+        dst.Y = r.Y;
+        dst.GlyphAdvanceX = r.GlyphAdvanceX;
+        dst.GlyphOffset = r.GlyphOffset;
+        dst.FontIndex = ImFontAtlasFindFontIndex(this, r.Font);
+        ImFontAtlasBuiltDataWrite(out_data, &dst, sizeof(dst));
+    }
+
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        const ImFont* font = Fonts[font_i];
+        IM_ASSERT(font->IndexAdvanceX.Size == font->IndexLookup.Size);
+        ImFontAtlasBuiltDataFont font_header;
+        memset(&font_header, 0, sizeof(font_header));
+        font_header.FontSize = font->FontSize;
+        font_header.Ascent = font->Ascent;
+        font_header.Descent = font->Descent;
+        font_header.FallbackAdvanceX = font->FallbackAdvanceX;
+        font_header.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_header.ConfigDataIndex = font->ConfigData ? (int)(font->ConfigData - ConfigData.Data) : -1;
+        font_header.ConfigDataCount = font->ConfigDataCount;
+        font_header.IsLoaded = font->ContainerAtlas ? 1 : 0;
+        font_header.Sdf = font->Sdf ? 1 : 0;
+        font_header.GlyphsCount = font->Glyphs.Size;
+        font_header.IndexSize = font->IndexLookup.Size;
+        font_header.IndexPagesCount = font->IndexPages.Size;
+        font_header.FallbackGlyphIndex = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+        ImFontAtlasBuiltDataWrite(out_data, &font_header, sizeof(font_header));
+        ImFontAtlasBuiltDataWrite(out_data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        ImFontAtlasBuiltDataWrite(out_data, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        ImFontAtlasBuiltDataWrite(out_data, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+        ImFontAtlasBuiltDataWrite(out_data, font->IndexPages.Data, (size_t)font->IndexPages.size_in_bytes());
+    }
+    ImFontAtlasBuiltDataWrite(out_data, TexPixelsAlpha8, (size_t)TexWidth * (size_t)TexHeight);
+
+    header.DataSize = (ImU32)out_data->Size;
+    memcpy(out_data->Data, &header, sizeof(header));
+    return true;
+}
+
+bool    ImFontAtlas::SaveBuiltDataToDisk(const char* filename) const
+{
+    ImVector<unsigned char> data;
+    if (!SaveBuiltDataToMemory(&data))
+        return false;
+    FILE* f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = (fwrite(data.Data, 1, (size_t)data.Size, f) == (size_t)data.Size);
+    fclose(f);
+    return ret;
+}
+
+ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
+    IM_ASSERT(font_cfg->SizePixels > 0.0f);
+
+    // Create new font
+    if (!font_cfg->MergeMode)
+        Fonts.push_back(IM_NEW(ImFont));
+    else
+        IM_ASSERT(!Fonts.empty() && "Cannot use MergeMode for the first font"); // When using MergeMode make sure that a font has already been added before. You can use ImGui::GetIO().Fonts->AddFontDefault() to add the default imgui font.
 
     ConfigData.push_back(*font_cfg);
     ImFontConfig& new_font_cfg = ConfigData.back();
@@ -1565,8 +2536,9 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
         memcpy(new_font_cfg.FontData, font_cfg->FontData, (size_t)new_font_cfg.FontDataSize);
     }
 
-    // Invalidate texture
-    ClearTexData();
+    // Invalidate texture, unless the new font can be added to it by BuildIncremental()
+    if (IncrementalData == NULL)
+        ClearTexData();
     return new_font_cfg.DstFont;
 }
 
@@ -1729,6 +2701,20 @@ bool    ImFontAtlas::Build()
     return ImFontAtlasBuildWithStbTruetype(this);
 }
 
+bool    ImFontAtlas::BuildIncremental()
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (IncrementalData == NULL || TexPixelsAlpha8 == NULL)
+        return false;
+
+    // New sources can only target new fonts: merging glyphs into a font already built would require rebuilding its lookup tables from all its sources.
+    for (int src_i = IncrementalData->ConfigDataBuilt; src_i < ConfigData.Size; src_i++)
+        for (int built_src_i = 0; built_src_i < IncrementalData->ConfigDataBuilt; built_src_i++)
+            if (ConfigData[built_src_i].DstFont == ConfigData[src_i].DstFont)
+                return false;
+    return ImFontAtlasBuildIncrementalWithStbTruetype(this);
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -1760,6 +2746,7 @@ struct ImFontBuildSrcData
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
     ImBoolVector        GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsMap)
+    ImVector<int>       GlyphsDynamicList;  // Glyph codepoints to rasterize on demand, not included in GlyphsCount (ImFontAtlasFlags_DynamicGlyphs)
 };
 
 // Temporary data for one destination ImFont* (multiple source fonts can be merged into one destination ImFont)
@@ -1783,18 +2770,199 @@ static void UnpackBoolVectorToFlatIndexList(const ImBoolVector* in, ImVector<int
                     out->push_back((int)((it - it_begin) << 5) + bit_n);
 }
 
-bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
+// Compute the glyph quad from the output of stb_truetype packing, applying ImFontConfig offset and advance constraints.
+static void ImFontAtlasBuildCalcGlyphQuad(const ImFontAtlas* atlas, const ImFont* dst_font, const ImFontConfig& cfg, const stbtt_packedchar& pc, stbtt_aligned_quad* out_q, float* out_advance_x)
+{
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + (float)(int)(dst_font->Ascent + 0.5f);
+
+    const float char_advance_x_org = pc.xadvance;
+    const float char_advance_x_mod = ImClamp(char_advance_x_org, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+    float char_off_x = font_off_x;
+    if (char_advance_x_org != char_advance_x_mod)
+        char_off_x += cfg.PixelSnapH ? (float)(int)((char_advance_x_mod - char_advance_x_org) * 0.5f) : (char_advance_x_mod - char_advance_x_org) * 0.5f;
+
+    float dummy_x = 0.0f, dummy_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &dummy_x, &dummy_y, out_q, 0);
+    out_q->x0 += char_off_x;
+    out_q->y0 += font_off_y;
+    out_q->x1 += char_off_x;
+    out_q->y1 += font_off_y;
+    *out_advance_x = char_advance_x_mod;
+}
+
+// Rasterization is split in jobs of up to IM_FONTATLAS_BUILD_JOB_GLYPHS glyphs of a same source when using ImFontAtlas::BuildParallelFor.
+// Each job writes into its own rectangles of the texture, so the output doesn't depend on how jobs are split or scheduled.
+#define IM_FONTATLAS_BUILD_JOB_GLYPHS   256
+
+struct ImFontBuildRasterJob
+{
+    int                 SrcIndex;
+    int                 GlyphsStart;
+    int                 GlyphsCount;
+};
+
+struct ImFontBuildRasterJobs
+{
+    ImFontAtlas*                    Atlas;
+    ImFontBuildSrcData*             SrcTmpArray;
+    const stbtt_pack_context*       PackContext;
+    ImVector<ImFontBuildRasterJob>  Jobs;
+};
+
+// Signed distance field glyphs (ImFontConfig::Sdf): 128 on the outline, reaching 0 (outside) and 255 (inside) at SdfSpread pixels.
+// Rectangles were sized in step 4 to fit the field, which extends SdfSpread pixels around the glyph bounding box.
+// We fill the stbtt_packedchar ourselves, the same way stbtt_PackFontRangesRenderIntoRects() does, so step 9 handles both kinds of glyphs.
+static void ImFontAtlasBuildRasterizeSdfJob(ImFontAtlas* atlas, const ImFontConfig& cfg, ImFontBuildSrcData& src_tmp, const ImFontBuildRasterJob& job)
+{
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+    const float pixel_dist_scale = 128.0f / cfg.SdfSpread;
+    for (int glyph_i = job.GlyphsStart; glyph_i < job.GlyphsStart + job.GlyphsCount; glyph_i++)
+    {
+        const stbrp_rect& r = src_tmp.Rects[glyph_i];
+        stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+        if (!r.was_packed)
+            continue;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+        pc.xadvance = scale * advance;
+
+        int w = 0, h = 0, x_off = 0, y_off = 0;
+        unsigned char* sdf = stbtt_GetGlyphSDF(&src_tmp.FontInfo, scale, glyph_index_in_font, cfg.SdfSpread, 128, pixel_dist_scale, &w, &h, &x_off, &y_off);
+        if (sdf == NULL)
+            continue; // Empty glyph (e.g. space): leave the quad empty
+        IM_ASSERT(w + atlas->TexGlyphPadding == r.w && h + atlas->TexGlyphPadding == r.h);
+        for (int y = 0; y < h; y++)
+            memcpy(atlas->TexPixelsAlpha8 + (r.y + y) * atlas->TexWidth + r.x, sdf + y * w, (size_t)w);
+        stbtt_FreeSDF(sdf, src_tmp.FontInfo.userdata);
+        pc.x0 = (unsigned short)r.x;
+        pc.y0 = (unsigned short)r.y;
+        pc.x1 = (unsigned short)(r.x + w);
+        pc.y1 = (unsigned short)(r.y + h);
+        pc.xoff = (float)x_off;
+        pc.yoff = (float)y_off;
+        pc.xoff2 = (float)(x_off + w);
+        pc.yoff2 = (float)(y_off + h);
+    }
+}
+
+static void ImFontAtlasBuildRasterizeJob(int job_index, void* func_arg)
+{
+    ImFontBuildRasterJobs* jobs = (ImFontBuildRasterJobs*)func_arg;
+    const ImFontBuildRasterJob& job = jobs->Jobs[job_index];
+    ImFontAtlas* atlas = jobs->Atlas;
+    ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcData& src_tmp = jobs->SrcTmpArray[job.SrcIndex];
+    if (cfg.Sdf)
+    {
+        ImFontAtlasBuildRasterizeSdfJob(atlas, cfg, src_tmp, job);
+        return;
+    }
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily writes to the pack context, so each job uses its own copy.
+    stbtt_pack_context spc = *jobs->PackContext;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.GlyphsStart;
+    pack_range.chardata_for_range += job.GlyphsStart;
+    pack_range.num_chars = job.GlyphsCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphsStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphsCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
+// Grow the texture of an atlas built incrementally. TexWidth doesn't change so existing pixels keep their offset.
+// UV of existing glyphs are recomputed from their texel coordinates, so they are the same as if they had been built with the new height.
+static void ImFontAtlasBuildGrowTexture(ImFontAtlas* atlas, int tex_height_old)
+{
+    const size_t size_old = (size_t)atlas->TexWidth * (size_t)tex_height_old;
+    const size_t size_new = (size_t)atlas->TexWidth * (size_t)atlas->TexHeight;
+    unsigned char* pixels_alpha8 = (unsigned char*)IM_ALLOC(size_new);
+    memcpy(pixels_alpha8, atlas->TexPixelsAlpha8, size_old);
+    memset(pixels_alpha8 + size_old, 0, size_new - size_old);
+    IM_FREE(atlas->TexPixelsAlpha8);
+    atlas->TexPixelsAlpha8 = pixels_alpha8;
+    if (atlas->TexPixelsRGBA32)
+    {
+        unsigned int* pixels_rgba32 = (unsigned int*)IM_ALLOC(size_new * 4);
+        memcpy(pixels_rgba32, atlas->TexPixelsRGBA32, size_old * 4);
+        for (size_t n = size_old; n < size_new; n++)
+            pixels_rgba32[n] = IM_COL32(255, 255, 255, 0);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = pixels_rgba32;
+    }
+
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        ImFont* font = atlas->Fonts[font_i];
+        for (int glyph_i = 0; glyph_i < font->Glyphs.Size; glyph_i++)
+        {
+            ImFontGlyph& glyph = font->Glyphs[glyph_i];
+            glyph.V0 = (float)(int)(glyph.V0 * tex_height_old + 0.5f) * atlas->TexUvScale.y;
+            glyph.V1 = (float)(int)(glyph.V1 * tex_height_old + 0.5f) * atlas->TexUvScale.y;
+        }
+    }
+    const ImFontAtlas::CustomRect& r = atlas->CustomRects[atlas->CustomRectIds[0]];
+    atlas->TexUvWhitePixel = ImVec2((r.X + 0.5f) * atlas->TexUvScale.x, (r.Y + 0.5f) * atlas->TexUvScale.y);
+}
+
+// Register custom rectangle glyphs from CustomRects[rects_begin] onward, build the lookup tables of modified fonts.
+static void ImFontAtlasBuildFinishFonts(ImFontAtlas* atlas, int rects_begin)
+{
+    // Register custom rectangle glyphs
+    for (int i = rects_begin; i < atlas->CustomRects.Size; i++)
+    {
+        const ImFontAtlas::CustomRect& r = atlas->CustomRects[i];
+        if (r.Font == NULL || r.ID > 0x10000)
+            continue;
+
+        IM_ASSERT(r.Font->ContainerAtlas == atlas);
+        ImVec2 uv0, uv1;
+        atlas->CalcCustomRectUV(&r, &uv0, &uv1);
+        r.Font->AddGlyph((ImWchar)r.ID, r.GlyphOffset.x, r.GlyphOffset.y, r.GlyphOffset.x + r.Width, r.GlyphOffset.y + r.Height, uv0.x, uv0.y, uv1.x, uv1.y, r.GlyphAdvanceX);
+    }
+
+    // Build all fonts lookup tables
+    for (int i = 0; i < atlas->Fonts.Size; i++)
+        if (atlas->Fonts[i]->DirtyLookupTables)
+            atlas->Fonts[i]->BuildLookupTable();
+    atlas->BuildCount = ImAtomicAdd(&GImFontAtlasBuildCounter, 1) + 1;
+}
+
+// When 'incremental' is set (BuildIncremental()), only the sources and custom rectangles added since the last build are packed, using the packer
+// kept in atlas->IncrementalData, and rasterized into the existing texture. Sources which were already built are skipped by every step.
+static bool ImFontAtlasBuildWithStbTruetypeEx(ImFontAtlas* atlas, bool incremental)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
+    IM_ASSERT(!incremental || (atlas->IncrementalData != NULL && atlas->TexPixelsAlpha8 != NULL));
 
     ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
 
     // Clear atlas
-    atlas->TexID = (ImTextureID)NULL;
-    atlas->TexWidth = atlas->TexHeight = 0;
-    atlas->TexUvScale = ImVec2(0.0f, 0.0f);
-    atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
-    atlas->ClearTexData();
+    ImFontAtlasIncrementalData* incremental_data = incremental ? atlas->IncrementalData : NULL;
+    const int src_begin = incremental ? incremental_data->ConfigDataBuilt : 0;
+    const int rects_begin = incremental ? incremental_data->CustomRectsBuilt : 0;
+    const int tex_height_old = atlas->TexHeight;
+    if (!incremental)
+    {
+        atlas->TexID = atlas->TexIDSdf = (ImTextureID)NULL;
+        atlas->TexWidth = atlas->TexHeight = 0;
+        atlas->TexUvScale = ImVec2(0.0f, 0.0f);
+        atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+        atlas->ClearTexData();
+        atlas->ClearTexDirtyRect();
+    }
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0;
 
     // Temporary storage for building
     ImVector<ImFontBuildSrcData> src_tmp_array;
@@ -1805,7 +2973,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(dst_tmp_array.Data, 0, (size_t)dst_tmp_array.size_in_bytes());
 
     // 1. Initialize font loading structure, check font data validity
-    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    for (int src_i = src_begin; src_i < atlas->ConfigData.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -1837,7 +3005,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
     int total_glyphs_count = 0;
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    for (int src_i = src_begin; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
@@ -1853,6 +3021,15 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
                     continue;
 
+                // With dynamic glyphs, only Basic Latin and the fallback character are baked. Other glyphs are measured in step 9 and rasterized on first use.
+                // Distance field glyphs are always baked.
+                if (dynamic_glyphs && !atlas->ConfigData[src_i].Sdf && codepoint >= 0x80 && codepoint != atlas->ConfigData[src_i].DstFont->FallbackChar)
+                {
+                    dst_tmp.GlyphsSet.SetBit(codepoint, true);
+                    src_tmp.GlyphsDynamicList.push_back(codepoint);
+                    continue;
+                }
+
                 // Add to avail set/counters
                 src_tmp.GlyphsCount++;
                 dst_tmp.GlyphsCount++;
@@ -1863,7 +3040,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 3. Unpack our bit map into a flat list (we now have all the Unicode points that we know are requested _and_ available _and_ not overlapping another)
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    for (int src_i = src_begin; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         src_tmp.GlyphsList.reserve(src_tmp.GlyphsCount);
@@ -1906,10 +3083,14 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.array_of_unicode_codepoints = src_tmp.GlyphsList.Data;
         src_tmp.PackRange.num_chars = src_tmp.GlyphsList.Size;
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
-        src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
-        src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
+        IM_ASSERT(!cfg.Sdf || cfg.SdfSpread > 0);
+        const int oversample_h = cfg.Sdf ? 1 : cfg.OversampleH;
+        const int oversample_v = cfg.Sdf ? 1 : cfg.OversampleV;
+        src_tmp.PackRange.h_oversample = (unsigned char)oversample_h;
+        src_tmp.PackRange.v_oversample = (unsigned char)oversample_v;
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+        // Distance fields extend SdfSpread pixels around non-empty glyphs (same size as computed by stbtt_GetGlyphSDF).
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         const int padding = atlas->TexGlyphPadding;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
@@ -1917,9 +3098,10 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+            const int sdf_border = (cfg.Sdf && x1 > x0 && y1 > y0) ? cfg.SdfSpread * 2 : 0;
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_border + padding + oversample_h - 1);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_border + padding + oversample_v - 1);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -1927,76 +3109,186 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
     // User can override TexDesiredWidth and TexGlyphPadding if they wish, otherwise we use a simple heuristic to select the width based on expected surface.
+    // When building incrementally, the width of the texture doesn't change and we keep packing into the space left free by previous builds.
     const int surface_sqrt = (int)ImSqrt((float)total_surface) + 1;
-    atlas->TexHeight = 0;
-    if (atlas->TexDesiredWidth > 0)
-        atlas->TexWidth = atlas->TexDesiredWidth;
-    else
-        atlas->TexWidth = (surface_sqrt >= 4096*0.7f) ? 4096 : (surface_sqrt >= 2048*0.7f) ? 2048 : (surface_sqrt >= 1024*0.7f) ? 1024 : 512;
+    atlas->TexHeight = incremental ? incremental_data->PackedHeight : 0;
+    if (!incremental)
+    {
+        if (atlas->TexDesiredWidth > 0)
+            atlas->TexWidth = atlas->TexDesiredWidth;
+        else if (dynamic_glyphs)
+            atlas->TexWidth = 1024;
+        else
+            atlas->TexWidth = (surface_sqrt >= 4096*0.7f) ? 4096 : (surface_sqrt >= 2048*0.7f) ? 2048 : (surface_sqrt >= 1024*0.7f) ? 1024 : 512;
+    }
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
     const int TEX_HEIGHT_MAX = 1024 * 32;
     stbtt_pack_context spc = {};
     stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
-    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
+    stbrp_context* pack_context = (stbrp_context*)spc.pack_info;
 
-    // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    // With dynamic glyphs, the texture is square and we use our own packer which is kept alive to add glyphs into the remaining space.
+    ImFontAtlasDynamicData* dynamic_data = NULL;
+    if (dynamic_glyphs)
     {
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
+        const int pack_size = atlas->TexWidth - atlas->TexGlyphPadding;
+        dynamic_data = IM_NEW(ImFontAtlasDynamicData)();
+        dynamic_data->PackNodes.resize(pack_size);
+        stbrp_init_target(&dynamic_data->PackContext, pack_size, pack_size, dynamic_data->PackNodes.Data, dynamic_data->PackNodes.Size);
+        pack_context = &dynamic_data->PackContext;
+    }
 
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+    // With ImFontAtlasFlags_Incremental, we use our own packer initialized the same way as stbtt_PackBegin() does, and keep it alive to pack rectangles added later.
+    else if (atlas->Flags & ImFontAtlasFlags_Incremental)
+    {
+        if (!incremental)
+        {
+            IM_ASSERT(atlas->IncrementalData == NULL);
+            incremental_data = atlas->IncrementalData = IM_NEW(ImFontAtlasIncrementalData)();
+            incremental_data->PackNodes.resize(atlas->TexWidth - atlas->TexGlyphPadding);
+            stbrp_init_target(&incremental_data->PackContext, atlas->TexWidth - atlas->TexGlyphPadding, TEX_HEIGHT_MAX - atlas->TexGlyphPadding, incremental_data->PackNodes.Data, incremental_data->PackNodes.Size);
+        }
+        pack_context = &incremental_data->PackContext;
+    }
+    // With a user-provided packer (BuildPackRects), custom rectangles and glyphs of all sources are packed in a single call, in the same area.
+    if (atlas->BuildPackRects != NULL && pack_context == (stbrp_context*)spc.pack_info)
+    {
+        ImVector<ImFontAtlasPackRect> pack_rects;
+        pack_rects.resize(atlas->CustomRects.Size + total_glyphs_count);
+        if (pack_rects.Size > 0)
+            memset(pack_rects.Data, 0, (size_t)pack_rects.size_in_bytes());
+        for (int i = 0; i < atlas->CustomRects.Size; i++)
+        {
+            pack_rects[i].W = atlas->CustomRects[i].Width;
+            pack_rects[i].H = atlas->CustomRects[i].Height;
+        }
+        for (int i = 0; i < total_glyphs_count; i++)
+        {
+            pack_rects[atlas->CustomRects.Size + i].W = buf_rects[i].w;
+            pack_rects[atlas->CustomRects.Size + i].H = buf_rects[i].h;
+        }
+        atlas->BuildPackRects(pack_rects.Data, pack_rects.Size, pack_context->width, pack_context->height, atlas->BuildPackRectsUserData);
+        for (int i = 0; i < pack_rects.Size; i++)
+        {
+            const ImFontAtlasPackRect& r = pack_rects[i];
+            IM_ASSERT(!r.WasPacked || (r.X >= 0 && r.Y >= 0 && r.X + r.W <= pack_context->width && r.Y + r.H <= pack_context->height));
+            if (i < atlas->CustomRects.Size)
+            {
+                if (r.WasPacked)
+                {
+                    atlas->CustomRects[i].X = (unsigned short)r.X;
+                    atlas->CustomRects[i].Y = (unsigned short)r.Y;
+                }
+                continue;
+            }
+            stbrp_rect& glyph_rect = buf_rects[i - atlas->CustomRects.Size];
+            glyph_rect.x = (stbrp_coord)r.X;
+            glyph_rect.y = (stbrp_coord)r.Y;
+            glyph_rect.was_packed = r.WasPacked ? 1 : 0;
+        }
+    }
+    else
+    {
+        ImFontAtlasBuildPackCustomRects(atlas, pack_context, rects_begin);
 
-        // Extend texture height and mark missing glyphs as non-packed so we won't render them.
-        // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
-            if (src_tmp.Rects[glyph_i].was_packed)
-                atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
+        // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+            if (src_tmp_array[src_i].GlyphsCount > 0)
+                stbrp_pack_rects(pack_context, src_tmp_array[src_i].Rects, src_tmp_array[src_i].GlyphsCount);
+    }
+
+    // Extend texture height, mark missing glyphs as non-packed so we won't render them, and gather packing statistics.
+    // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
+    for (int i = rects_begin; i < atlas->CustomRects.Size; i++)
+    {
+        const ImFontAtlas::CustomRect& r = atlas->CustomRects[i];
+        if (!r.IsPacked())
+            continue;
+        atlas->TexHeight = ImMax(atlas->TexHeight, r.Y + r.Height);
+        atlas->PackedRectsCount++;
+        atlas->PackedSurface += r.Width * r.Height;
+    }
+    for (int glyph_i = 0; glyph_i < total_glyphs_count; glyph_i++)
+    {
+        const stbrp_rect& r = buf_rects[glyph_i];
+        if (!r.was_packed)
+            continue;
+        atlas->TexHeight = ImMax(atlas->TexHeight, r.y + r.h);
+        atlas->PackedRectsCount++;
+        atlas->PackedSurface += r.w * r.h;
+    }
+    atlas->PackedHeight = atlas->TexHeight;
+
+    // Save the packer state so dynamic glyphs can be repacked from scratch when the texture is full (see ImFontAtlasUpdateDynamicGlyphs())
+    // The copy is only ever restored over the live packer: the pointers it contains stay valid.
+    if (dynamic_data)
+    {
+        dynamic_data->PackContextBaked = dynamic_data->PackContext;
+        dynamic_data->PackNodesBaked = dynamic_data->PackNodes;
     }
 
     // 7. Allocate texture
-    atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    // When building incrementally, the texture only grows if the new rectangles don't fit in the current height.
+    if (incremental_data)
+        incremental_data->PackedHeight = atlas->TexHeight;
+    if (dynamic_glyphs)
+        atlas->TexHeight = atlas->TexWidth;
+    else if (incremental && atlas->TexHeight <= tex_height_old)
+        atlas->TexHeight = tex_height_old;
+    else
+        atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
-    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
-    memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+    if (!incremental)
+    {
+        atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
+        memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+    }
+    else if (atlas->TexHeight != tex_height_old)
+    {
+        ImFontAtlasBuildGrowTexture(atlas, tex_height_old);
+    }
     spc.pixels = atlas->TexPixelsAlpha8;
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Without BuildParallelFor, each source is rasterized in a single job on the calling thread.
+    ImFontBuildRasterJobs raster_jobs;
+    raster_jobs.Atlas = atlas;
+    raster_jobs.SrcTmpArray = src_tmp_array.Data;
+    raster_jobs.PackContext = &spc;
+    const int job_glyphs_max = atlas->BuildParallelFor ? IM_FONTATLAS_BUILD_JOB_GLYPHS : INT_MAX;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyphs_start = 0; glyphs_start < src_tmp_array[src_i].GlyphsCount; glyphs_start += job_glyphs_max)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRasterJob job;
+            job.SrcIndex = src_i;
+            job.GlyphsStart = glyphs_start;
+            job.GlyphsCount = ImMin(src_tmp_array[src_i].GlyphsCount - glyphs_start, job_glyphs_max);
+            raster_jobs.Jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
-    }
+    if (atlas->BuildParallelFor && raster_jobs.Jobs.Size > 1)
+        atlas->BuildParallelFor(raster_jobs.Jobs.Size, ImFontAtlasBuildRasterizeJob, &raster_jobs, atlas->BuildParallelForUserData);
+    else
+        for (int job_i = 0; job_i < raster_jobs.Jobs.Size; job_i++)
+            ImFontAtlasBuildRasterizeJob(job_i, &raster_jobs);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    // Growing ConfigData[] may have moved the ImFontConfig structures that fonts already built point to.
+    for (int src_i = 0; src_i < src_begin; src_i++)
+        if (!atlas->ConfigData[src_i].MergeMode)
+            atlas->ConfigData[src_i].DstFont->ConfigData = &atlas->ConfigData[src_i];
+    for (int src_i = src_begin; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        if (src_tmp.GlyphsCount == 0 && src_tmp.GlyphsDynamicList.Size == 0)
             continue;
 
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -2009,36 +3301,84 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         const float ascent = ImFloor(unscaled_ascent * font_scale + ((unscaled_ascent > 0.0f) ? +1 : -1));
         const float descent = ImFloor(unscaled_descent * font_scale + ((unscaled_descent > 0.0f) ? +1 : -1));
         ImFontAtlasBuildSetupFont(atlas, dst_font, &cfg, ascent, descent);
-        const float font_off_x = cfg.GlyphOffset.x;
-        const float font_off_y = cfg.GlyphOffset.y + (float)(int)(dst_font->Ascent + 0.5f);
 
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
-            const int codepoint = src_tmp.GlyphsList[glyph_i];
-            const stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
-
-            const float char_advance_x_org = pc.xadvance;
-            const float char_advance_x_mod = ImClamp(char_advance_x_org, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
-            float char_off_x = font_off_x;
-            if (char_advance_x_org != char_advance_x_mod)
-                char_off_x += cfg.PixelSnapH ? (float)(int)((char_advance_x_mod - char_advance_x_org) * 0.5f) : (char_advance_x_mod - char_advance_x_org) * 0.5f;
-
             // Register glyph
+            const int codepoint = src_tmp.GlyphsList[glyph_i];
             stbtt_aligned_quad q;
-            float dummy_x = 0.0f, dummy_y = 0.0f;
-            stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &dummy_x, &dummy_y, &q, 0);
-            dst_font->AddGlyph((ImWchar)codepoint, q.x0 + char_off_x, q.y0 + font_off_y, q.x1 + char_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, char_advance_x_mod);
+            float advance_x;
+            ImFontAtlasBuildCalcGlyphQuad(atlas, dst_font, cfg, src_tmp.PackedChars[glyph_i], &q, &advance_x);
+            dst_font->AddGlyph((ImWchar)codepoint, q.x0, q.y0, q.x1, q.y1, q.s0, q.t0, q.s1, q.t1, advance_x);
+        }
+
+        // Register glyphs rasterized on demand. Only the advance is needed before they are rendered (for CalcTextSize), it is computed the same way as stbtt_PackFontRangesRenderIntoRects() does.
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsDynamicList.Size; glyph_i++)
+        {
+            const int codepoint = src_tmp.GlyphsDynamicList[glyph_i];
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint), &advance, &lsb);
+            dst_font->AddGlyph((ImWchar)codepoint, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, ImClamp(scale * advance, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX));
+            dst_font->Glyphs.back().DynamicSlot = IM_FONTGLYPH_DYNAMIC_NOT_RESIDENT;
         }
     }
 
+    // Keep source fonts for glyphs rasterized on demand
+    if (dynamic_data)
+    {
+        dynamic_data->FontInfos.resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+            dynamic_data->FontInfos[src_i] = src_tmp_array[src_i].FontInfo;
+        atlas->DynamicData = dynamic_data;
+    }
+
     // Cleanup temporary (ImVector doesn't honor destructor)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
         src_tmp_array[src_i].~ImFontBuildSrcData();
 
-    ImFontAtlasBuildFinish(atlas);
+    if (!incremental)
+    {
+        ImFontAtlasBuildFinish(atlas);
+    }
+    else
+    {
+        // Mark new rectangles as dirty (which also converts them to TexPixelsRGBA32). The whole texture needs to be uploaded again if it grew.
+        for (int src_i = src_begin; src_i < src_tmp_array.Size; src_i++)
+            for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i++)
+            {
+                const stbtt_packedchar& pc = src_tmp_array[src_i].PackedChars[glyph_i];
+                ImFontAtlasBuildMarkTexDirty(atlas, pc.x0, pc.y0, pc.x1 - pc.x0, pc.y1 - pc.y0);
+            }
+        for (int i = rects_begin; i < atlas->CustomRects.Size; i++)
+            if (atlas->CustomRects[i].IsPacked())
+                ImFontAtlasBuildMarkTexDirty(atlas, atlas->CustomRects[i].X, atlas->CustomRects[i].Y, atlas->CustomRects[i].Width, atlas->CustomRects[i].Height);
+        if (atlas->TexHeight != tex_height_old)
+        {
+            atlas->TexDirtyX0 = atlas->TexDirtyY0 = 0;
+            atlas->TexDirtyX1 = atlas->TexWidth;
+            atlas->TexDirtyY1 = atlas->TexHeight;
+        }
+        ImFontAtlasBuildFinishFonts(atlas, rects_begin);
+    }
+    if (incremental_data)
+    {
+        incremental_data->ConfigDataBuilt = atlas->ConfigData.Size;
+        incremental_data->CustomRectsBuilt = atlas->CustomRects.Size;
+    }
     return true;
 }
 
+bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
+{
+    return ImFontAtlasBuildWithStbTruetypeEx(atlas, false);
+}
+
+bool    ImFontAtlasBuildIncrementalWithStbTruetype(ImFontAtlas* atlas)
+{
+    return ImFontAtlasBuildWithStbTruetypeEx(atlas, true);
+}
+
 void ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtlas* atlas)
 {
     if (atlas->CustomRectIds[0] >= 0)
@@ -2059,37 +3399,149 @@ void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* f
         font->ContainerAtlas = atlas;
         font->Ascent = ascent;
         font->Descent = descent;
+        font->Sdf = font_config->Sdf;
     }
+    IM_ASSERT(font->Sdf == font_config->Sdf && "All sources merged into a font must use the same ImFontConfig::Sdf setting.");
     font->ConfigDataCount++;
 }
 
-void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque)
+void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque, int rects_begin)
 {
     stbrp_context* pack_context = (stbrp_context*)stbrp_context_opaque;
     IM_ASSERT(pack_context != NULL);
 
     ImVector<ImFontAtlas::CustomRect>& user_rects = atlas->CustomRects;
     IM_ASSERT(user_rects.Size >= 1); // We expect at least the default custom rects to be registered, else something went wrong.
+    IM_ASSERT(rects_begin >= 0 && rects_begin <= user_rects.Size);
+    if (rects_begin == user_rects.Size)
+        return;
 
     ImVector<stbrp_rect> pack_rects;
-    pack_rects.resize(user_rects.Size);
+    pack_rects.resize(user_rects.Size - rects_begin);
     memset(pack_rects.Data, 0, (size_t)pack_rects.size_in_bytes());
-    for (int i = 0; i < user_rects.Size; i++)
+    for (int i = 0; i < pack_rects.Size; i++)
     {
-        pack_rects[i].w = user_rects[i].Width;
-        pack_rects[i].h = user_rects[i].Height;
+        pack_rects[i].w = user_rects[rects_begin + i].Width;
+        pack_rects[i].h = user_rects[rects_begin + i].Height;
     }
     stbrp_pack_rects(pack_context, &pack_rects[0], pack_rects.Size);
     for (int i = 0; i < pack_rects.Size; i++)
         if (pack_rects[i].was_packed)
         {
-            user_rects[i].X = pack_rects[i].x;
-            user_rects[i].Y = pack_rects[i].y;
-            IM_ASSERT(pack_rects[i].w == user_rects[i].Width && pack_rects[i].h == user_rects[i].Height);
+            ImFontAtlas::CustomRect& user_rect = user_rects[rects_begin + i];
+            user_rect.X = pack_rects[i].x;
+            user_rect.Y = pack_rects[i].y;
+            IM_ASSERT(pack_rects[i].w == user_rect.Width && pack_rects[i].h == user_rect.Height);
             atlas->TexHeight = ImMax(atlas->TexHeight, pack_rects[i].y + pack_rects[i].h);
         }
 }
 
+void ImFontAtlas::PackRectsSkyline(ImFontAtlasPackRect* rects, int rects_count, int width, int height_max, void*)
+{
+    ImVector<stbrp_node> pack_nodes;
+    pack_nodes.resize(width);
+    stbrp_context pack_context;
+    stbrp_init_target(&pack_context, width, height_max, pack_nodes.Data, pack_nodes.Size);
+
+    ImVector<stbrp_rect> pack_rects;
+    IM_ASSERT(rects_count >= 0);
+    pack_rects.resize(rects_count);
+    if (rects_count > 0)
+        memset(pack_rects.Data, 0, (size_t)pack_rects.size_in_bytes());
+    for (int i = 0; i < rects_count; i++)
+    {
+        pack_rects[i].w = (stbrp_coord)rects[i].W;
+        pack_rects[i].h = (stbrp_coord)rects[i].H;
+    }
+    if (rects_count > 0)
+        stbrp_pack_rects(&pack_context, pack_rects.Data, rects_count);
+    for (int i = 0; i < rects_count; i++)
+    {
+        rects[i].X = pack_rects[i].x;
+        rects[i].Y = pack_rects[i].y;
+        rects[i].WasPacked = pack_rects[i].was_packed != 0;
+    }
+}
+
+// A shelf is a horizontal band of the texture, filled from left to right with rectangles at most IM_FONTATLAS_SHELF_HEIGHT_TOLERANCE(h) pixels shorter than it.
+#define IM_FONTATLAS_SHELF_HEIGHT_TOLERANCE(_H)  ((_H) / 8 + 1)
+
+struct ImFontAtlasPackShelf
+{
+    int     Y, H;
+    int     X;          // Left of the free space
+};
+
+static int IMGUI_CDECL PackRectComparerByHeight(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasPackRect* a = *(const ImFontAtlasPackRect* const*)lhs;
+    const ImFontAtlasPackRect* b = *(const ImFontAtlasPackRect* const*)rhs;
+    if (a->H != b->H)
+        return (a->H > b->H) ? -1 : +1;
+    if (a->W != b->W)
+        return (a->W > b->W) ? -1 : +1;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Rectangles are sorted from the tallest to the shortest, so shelves are created from the tallest to the shortest and a rectangle
+// always fits in the height of every existing shelf: we pick the last (shortest) shelf with enough free width, within the tolerance.
+void ImFontAtlas::PackRectsShelf(ImFontAtlasPackRect* rects, int rects_count, int width, int height_max, void*)
+{
+    ImVector<ImFontAtlasPackRect*> sorted_rects;
+    sorted_rects.resize(rects_count);
+    for (int i = 0; i < rects_count; i++)
+    {
+        rects[i].X = rects[i].Y = 0;
+        rects[i].WasPacked = false;
+        sorted_rects[i] = &rects[i];
+    }
+    if (rects_count > 0)
+        ImQsort(sorted_rects.Data, (size_t)rects_count, sizeof(ImFontAtlasPackRect*), PackRectComparerByHeight);
+
+    ImVector<ImFontAtlasPackShelf> shelves;
+    int shelves_bottom = 0;
+    for (int i = 0; i < rects_count; i++)
+    {
+        ImFontAtlasPackRect* r = sorted_rects[i];
+        if (r->W == 0 || r->H == 0)
+        {
+            r->WasPacked = true; // Same as stb_rect_pack.h
+            continue;
+        }
+        if (r->W > width || r->H > height_max)
+            continue;
+
+        int shelf_n = -1;
+        for (int n = shelves.Size - 1; n >= 0 && shelves[n].H <= r->H + IM_FONTATLAS_SHELF_HEIGHT_TOLERANCE(r->H); n--)
+            if (shelves[n].X + r->W <= width)
+            {
+                shelf_n = n;
+                break;
+            }
+        if (shelf_n == -1 && shelves_bottom + r->H <= height_max)
+        {
+            ImFontAtlasPackShelf shelf;
+            shelf.Y = shelves_bottom;
+            shelf.H = r->H;
+            shelf.X = 0;
+            shelves.push_back(shelf);
+            shelves_bottom += r->H;
+            shelf_n = shelves.Size - 1;
+        }
+        for (int n = shelves.Size - 1; n >= 0 && shelf_n == -1; n--) // Out of height: use any shelf with enough free width
+            if (shelves[n].X + r->W <= width)
+                shelf_n = n;
+        if (shelf_n == -1)
+            continue;
+
+        ImFontAtlasPackShelf& shelf = shelves[shelf_n];
+        r->X = shelf.X;
+        r->Y = shelf.Y;
+        r->WasPacked = true;
+        shelf.X += r->W;
+    }
+}
+
 static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->CustomRectIds[0] >= 0);
@@ -2126,23 +3578,282 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     // Render into our custom data block
     ImFontAtlasBuildRenderDefaultTexData(atlas);
 
-    // Register custom rectangle glyphs
-    for (int i = 0; i < atlas->CustomRects.Size; i++)
+    // Register custom rectangle glyphs, build lookup tables
+    ImFontAtlasBuildFinishFonts(atlas, 0);
+}
+
+// Call after modifying a region of TexPixelsAlpha8 once the atlas is built: update TexPixelsRGBA32 if it was created and grow the dirty rectangle.
+void ImFontAtlasBuildMarkTexDirty(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    if (w <= 0 || h <= 0)
+        return;
+    if (atlas->TexPixelsRGBA32)
+        for (int row = y; row < y + h; row++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + x + row * atlas->TexWidth;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + x + row * atlas->TexWidth;
+            for (int n = w; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+    if (atlas->TexDirtyX1 <= atlas->TexDirtyX0)
     {
-        const ImFontAtlas::CustomRect& r = atlas->CustomRects[i];
-        if (r.Font == NULL || r.ID > 0x10000)
+        atlas->TexDirtyX0 = x;
+        atlas->TexDirtyY0 = y;
+        atlas->TexDirtyX1 = x + w;
+        atlas->TexDirtyY1 = y + h;
+    }
+    else
+    {
+        atlas->TexDirtyX0 = ImMin(atlas->TexDirtyX0, x);
+        atlas->TexDirtyY0 = ImMin(atlas->TexDirtyY0, y);
+        atlas->TexDirtyX1 = ImMax(atlas->TexDirtyX1, x + w);
+        atlas->TexDirtyY1 = ImMax(atlas->TexDirtyY1, y + h);
+    }
+}
+
+// Find which source font a glyph rasterized on demand comes from, with the same priority rules as ImFontAtlasBuildWithStbTruetype()
+static int ImFontAtlasDynamicFindGlyphSource(ImFontAtlas* atlas, const ImFont* font, int codepoint)
+{
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        if (cfg.DstFont != font)
             continue;
+        for (const ImWchar* src_range = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault(); src_range[0] && src_range[1]; src_range += 2)
+            if (codepoint >= src_range[0] && codepoint <= src_range[1])
+            {
+                if (stbtt_FindGlyphIndex(&atlas->DynamicData->FontInfos[src_i], codepoint))
+                    return src_i;
+                break;
+            }
+    }
+    return -1;
+}
 
-        IM_ASSERT(r.Font->ContainerAtlas == atlas);
-        ImVec2 uv0, uv1;
-        atlas->CalcCustomRectUV(&r, &uv0, &uv1);
-        r.Font->AddGlyph((ImWchar)r.ID, r.GlyphOffset.x, r.GlyphOffset.y, r.GlyphOffset.x + r.Width, r.GlyphOffset.y + r.Height, uv0.x, uv0.y, uv1.x, uv1.y, r.GlyphAdvanceX);
+static void ImFontAtlasDynamicSetGlyphUV(const ImFontAtlas* atlas, ImFontGlyph* glyph, const ImFontAtlasDynamicSlot& slot)
+{
+    // Same as stbtt_GetPackedQuad(), the padding is on the left and top of the packed rectangle
+    const float ipw = 1.0f / atlas->TexWidth, iph = 1.0f / atlas->TexHeight;
+    const int pad = atlas->TexGlyphPadding;
+    glyph->U0 = (float)(slot.X + pad) * ipw;
+    glyph->V0 = (float)(slot.Y + pad) * iph;
+    glyph->U1 = (float)(slot.X + slot.W) * ipw;
+    glyph->V1 = (float)(slot.Y + slot.H) * iph;
+}
+
+// Find space for a glyph in the texture and rasterize it. Return false if the texture is full.
+// Space given by the packer was either never used or cleared by ImFontAtlasUpdateDynamicGlyphs(), so we don't need to clear it.
+static bool ImFontAtlasDynamicAddGlyph(ImFontAtlas* atlas, ImFont* font, int glyph_index)
+{
+    ImFontAtlasDynamicData* dyn = atlas->DynamicData;
+    ImFontGlyph* glyph = &font->Glyphs[glyph_index];
+    int codepoint = (int)glyph->Codepoint;
+    const int src_i = ImFontAtlasDynamicFindGlyphSource(atlas, font, codepoint);
+    if (src_i < 0 || dyn->Slots.Size >= IM_FONTGLYPH_DYNAMIC_SLOTS_MAX)
+        return false;
+
+    // Measure and pack (this is based on stbtt_PackFontRangesGatherRects)
+    const ImFontConfig& cfg = atlas->ConfigData[src_i];
+    const stbtt_fontinfo* font_info = &dyn->FontInfos[src_i];
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, stbtt_FindGlyphIndex(font_info, codepoint), scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect rect;
+    memset(&rect, 0, sizeof(rect));
+    rect.w = (stbrp_coord)(x1 - x0 + atlas->TexGlyphPadding + cfg.OversampleH - 1);
+    rect.h = (stbrp_coord)(y1 - y0 + atlas->TexGlyphPadding + cfg.OversampleV - 1);
+    stbrp_pack_rects(&dyn->PackContext, &rect, 1);
+    if (!rect.was_packed)
+        return false;
+
+    ImFontAtlasDynamicSlot slot;
+    slot.Font = font;
+    slot.GlyphIndex = glyph_index;
+    slot.LastUsedFrame = dyn->FrameCount;
+    slot.X = rect.x;
+    slot.Y = rect.y;
+    slot.W = rect.w;
+    slot.H = rect.h;
+    dyn->Slots.push_back(slot);
+    glyph->DynamicSlot = (ImU16)dyn->Slots.Size;
+
+    // Rasterize into the packed rectangle, exactly like ImFontAtlasBuildWithStbTruetype() does for baked glyphs
+    stbtt_packedchar pc;
+    memset(&pc, 0, sizeof(pc));
+    stbtt_pack_range range = {};
+    range.font_size = cfg.SizePixels;
+    range.array_of_unicode_codepoints = &codepoint;
+    range.num_chars = 1;
+    range.chardata_for_range = &pc;
+    range.h_oversample = (unsigned char)cfg.OversampleH;
+    range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_pack_context spc = {};
+    spc.pixels = atlas->TexPixelsAlpha8;
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = atlas->TexGlyphPadding;
+    stbtt_PackFontRangesRenderIntoRects(&spc, font_info, &range, 1, &rect);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
     }
 
-    // Build all fonts lookup tables
-    for (int i = 0; i < atlas->Fonts.Size; i++)
-        if (atlas->Fonts[i]->DirtyLookupTables)
-            atlas->Fonts[i]->BuildLookupTable();
+    // The advance was already computed by ImFontAtlasBuildWithStbTruetype()
+    stbtt_aligned_quad q;
+    float advance_x;
+    ImFontAtlasBuildCalcGlyphQuad(atlas, font, cfg, pc, &q, &advance_x);
+    glyph->X0 = q.x0;
+    glyph->Y0 = q.y0;
+    glyph->X1 = q.x1;
+    glyph->Y1 = q.y1;
+    glyph->U0 = q.s0;
+    glyph->V0 = q.t0;
+    glyph->U1 = q.s1;
+    glyph->V1 = q.t1;
+
+    ImFontAtlasBuildMarkTexDirty(atlas, slot.X, slot.Y, slot.W, slot.H);
+    dyn->Stats.GlyphsRasterized++;
+    dyn->Stats.GlyphsResident = dyn->Slots.Size;
+    return true;
+}
+
+// Called by ImFont::FindGlyph() for glyphs rasterized on demand. Return false if the glyph is not in the texture (yet).
+static bool ImFontAtlasDynamicUseGlyph(ImFontAtlas* atlas, ImFont* font, int glyph_index)
+{
+    ImFontAtlasDynamicData* dyn = atlas->DynamicData;
+    if (dyn == NULL)
+        return false;
+    ImFontGlyph* glyph = &font->Glyphs[glyph_index];
+    if (glyph->DynamicSlot <= IM_FONTGLYPH_DYNAMIC_SLOTS_MAX)
+    {
+        dyn->Slots[glyph->DynamicSlot - 1].LastUsedFrame = dyn->FrameCount;
+        return true;
+    }
+    if (glyph->DynamicSlot == IM_FONTGLYPH_DYNAMIC_PENDING || glyph->DynamicSlot == IM_FONTGLYPH_DYNAMIC_DROPPED)
+        return false;
+    if (ImFontAtlasDynamicAddGlyph(atlas, font, glyph_index))
+        return true;
+
+    // The texture is full. Evicting now would invalidate texture coordinates already used during this frame, so queue the glyph for the next frame.
+    ImFontAtlasDynamicSlot pending;
+    memset(&pending, 0, sizeof(pending));
+    pending.Font = font;
+    pending.GlyphIndex = glyph_index;
+    dyn->Pending.push_back(pending);
+    glyph->DynamicSlot = IM_FONTGLYPH_DYNAMIC_PENDING;
+    return false;
+}
+
+static int IMGUI_CDECL DynamicSlotComparerByLastUsedFrame(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasDynamicSlot* a = (const ImFontAtlasDynamicSlot*)lhs;
+    const ImFontAtlasDynamicSlot* b = (const ImFontAtlasDynamicSlot*)rhs;
+    if (a->LastUsedFrame != b->LastUsedFrame)
+        return (a->LastUsedFrame > b->LastUsedFrame) ? -1 : +1;     // Most recently used first
+    if (a->Y != b->Y)
+        return (int)a->Y - (int)b->Y;
+    return (int)a->X - (int)b->X;
+}
+
+// Called by ImGui::NewFrame(). If some glyphs didn't fit in the texture during the last frame, restart packing from the state
+// right after Build(): pending glyphs first, then resident glyphs from the most recently used (their pixels are moved, not rasterized again).
+// Glyphs used during the last frame are kept if they fit. Older glyphs are only kept up to 3/4 of the previous area, so the following
+// frames can add new glyphs without going through this again. Evicted glyphs will be rasterized again on their next use.
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* dyn = atlas->DynamicData;
+    if (dyn == NULL)
+        return;
+    dyn->FrameCount++;
+    if (dyn->Pending.empty())
+        return;
+
+    // Fallback glyphs may be returned by FindGlyph() without going through ImFontAtlasDynamicUseGlyph(), never evict them
+    ImVector<ImFontAtlasDynamicSlot> old_slots;
+    old_slots.swap(dyn->Slots);
+    for (int n = 0; n < old_slots.Size; n++)
+        if (old_slots[n].Font->FallbackGlyph == &old_slots[n].Font->Glyphs[old_slots[n].GlyphIndex])
+            old_slots[n].LastUsedFrame = INT_MAX;
+    ImQsort(old_slots.Data, (size_t)old_slots.Size, sizeof(ImFontAtlasDynamicSlot), DynamicSlotComparerByLastUsedFrame);
+
+    // Keep a copy of the texture, clear all dynamic glyphs from it and restore the packer
+    int old_area = 0, kept_area = 0;
+    for (int n = 0; n < old_slots.Size; n++)
+        old_area += old_slots[n].W * old_slots[n].H;
+    const int old_area_budget = old_area - old_area / 4;
+
+    const int tex_w = atlas->TexWidth;
+    ImVector<unsigned char> old_pixels;
+    old_pixels.resize(tex_w * atlas->TexHeight);
+    memcpy(old_pixels.Data, atlas->TexPixelsAlpha8, (size_t)old_pixels.Size);
+    for (int n = 0; n < old_slots.Size; n++)
+    {
+        const ImFontAtlasDynamicSlot& slot = old_slots[n];
+        for (int row = 0; row < slot.H; row++)
+            memset(atlas->TexPixelsAlpha8 + slot.X + (slot.Y + row) * tex_w, 0, slot.W);
+        slot.Font->Glyphs[slot.GlyphIndex].DynamicSlot = IM_FONTGLYPH_DYNAMIC_NOT_RESIDENT;
+    }
+    dyn->PackContext = dyn->PackContextBaked;
+    memcpy(dyn->PackNodes.Data, dyn->PackNodesBaked.Data, (size_t)dyn->PackNodes.size_in_bytes());
+
+    // Glyphs which were needed last frame first. A glyph which doesn't fit now would fail again on every frame and trigger
+    // another compaction (and a full texture upload) each time: drop it.
+    for (int n = 0; n < dyn->Pending.Size; n++)
+    {
+        ImFontAtlasDynamicSlot& pending = dyn->Pending[n];
+        ImFontGlyph* glyph = &pending.Font->Glyphs[pending.GlyphIndex];
+        glyph->DynamicSlot = IM_FONTGLYPH_DYNAMIC_NOT_RESIDENT;
+        if (!ImFontAtlasDynamicAddGlyph(atlas, pending.Font, pending.GlyphIndex))
+        {
+            glyph->DynamicSlot = IM_FONTGLYPH_DYNAMIC_DROPPED;
+            dyn->Stats.GlyphsDropped++;
+        }
+    }
+    dyn->Pending.resize(0);
+
+    // Then move previously resident glyphs while they fit
+    for (int n = 0; n < old_slots.Size; n++)
+    {
+        ImFontAtlasDynamicSlot slot = old_slots[n];
+        const bool used_last_frame = (slot.LastUsedFrame >= dyn->FrameCount - 1);
+        stbrp_rect rect;
+        memset(&rect, 0, sizeof(rect));
+        rect.w = slot.W;
+        rect.h = slot.H;
+        if (used_last_frame || kept_area + slot.W * slot.H <= old_area_budget)
+            stbrp_pack_rects(&dyn->PackContext, &rect, 1);
+        if (!rect.was_packed)
+        {
+            dyn->Stats.GlyphsEvicted++;
+            continue;
+        }
+        kept_area += slot.W * slot.H;
+        for (int row = 0; row < slot.H; row++)
+            memcpy(atlas->TexPixelsAlpha8 + rect.x + (rect.y + row) * tex_w, old_pixels.Data + slot.X + (slot.Y + row) * tex_w, slot.W);
+        slot.X = rect.x;
+        slot.Y = rect.y;
+        if (slot.LastUsedFrame == INT_MAX)
+            slot.LastUsedFrame = dyn->FrameCount;
+        dyn->Slots.push_back(slot);
+        ImFontGlyph* glyph = &slot.Font->Glyphs[slot.GlyphIndex];
+        glyph->DynamicSlot = (ImU16)dyn->Slots.Size;
+        ImFontAtlasDynamicSetGlyphUV(atlas, glyph, slot);
+    }
+
+    ImFontAtlasBuildMarkTexDirty(atlas, 0, 0, tex_w, atlas->TexHeight);
+    dyn->Stats.GlyphsResident = dyn->Slots.Size;
+    dyn->Stats.Compactions++;
+}
+
+bool ImFontAtlasGetDynamicStats(const ImFontAtlas* atlas, ImFontAtlasDynamicStats* out_stats)
+{
+    if (atlas->DynamicData == NULL)
+        return false;
+    *out_stats = atlas->DynamicData->Stats;
+    return true;
 }
 
 // Retrieve list of range (2 int per range, values are inclusive)
@@ -2420,6 +4131,7 @@ ImFont::ImFont()
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    Sdf = false;
 }
 
 ImFont::~ImFont()
@@ -2434,11 +4146,13 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    Sdf = false;
 }
 
 void ImFont::BuildLookupTable()
@@ -2450,13 +4164,25 @@ void ImFont::BuildLookupTable()
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     DirtyLookupTables = false;
+
+    // Allocate pages containing glyphs in code-point order (the first page is always allocated, see GetIndexOffset())
     GrowIndex(max_codepoint + 1);
+    for (int i = 0; i < Glyphs.Size; i++)
+        IndexPages[(int)Glyphs[i].Codepoint / IM_FONT_INDEX_PAGE_SIZE] = 1;
+    IndexPages[0] = 0;
+    int pages_count = 1;
+    for (int page = 1; page < IndexPages.Size; page++)
+        if (IndexPages[page])
+            IndexPages[page] = (ImU16)pages_count++;
+    IndexAdvanceX.resize(pages_count * IM_FONT_INDEX_PAGE_SIZE, -1.0f);
+    IndexLookup.resize(pages_count * IM_FONT_INDEX_PAGE_SIZE, (ImWchar)-1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
-        int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        const int index_offset = GetIndexOffset(Glyphs[i].Codepoint);
+        IndexAdvanceX[index_offset] = Glyphs[i].AdvanceX;
+        IndexLookup[index_offset] = (ImWchar)i;
     }
 
     // Create a glyph to handle TAB
@@ -2475,7 +4201,7 @@ void ImFont::BuildLookupTable()
 
     FallbackGlyph = FindGlyphNoFallback(FallbackChar);
     FallbackAdvanceX = FallbackGlyph ? FallbackGlyph->AdvanceX : 0.0f;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
 }
@@ -2486,13 +4212,31 @@ void ImFont::SetFallbackChar(ImWchar c)
     BuildLookupTable();
 }
 
+// Grow the page table to cover 'new_size' code-points. Pages are allocated by AllocIndexOffset() or BuildLookupTable().
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
-        return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    const int new_pages_count = (new_size + IM_FONT_INDEX_PAGE_SIZE - 1) / IM_FONT_INDEX_PAGE_SIZE;
+    if (new_pages_count > IndexPages.Size)
+        IndexPages.resize(new_pages_count, 0);
+}
+
+int ImFont::AllocIndexOffset(ImWchar c)
+{
+    GrowIndex((int)c + 1);
+    if (IndexLookup.Size == 0) // First page is always allocated
+    {
+        IndexAdvanceX.resize(IM_FONT_INDEX_PAGE_SIZE, FallbackAdvanceX);
+        IndexLookup.resize(IM_FONT_INDEX_PAGE_SIZE, (ImWchar)-1);
+    }
+    const int page = (int)c / IM_FONT_INDEX_PAGE_SIZE;
+    if (page > 0 && IndexPages[page] == 0)
+    {
+        IndexPages[page] = (ImU16)(IndexLookup.Size / IM_FONT_INDEX_PAGE_SIZE);
+        IndexAdvanceX.resize(IndexAdvanceX.Size + IM_FONT_INDEX_PAGE_SIZE, FallbackAdvanceX);
+        IndexLookup.resize(IndexLookup.Size + IM_FONT_INDEX_PAGE_SIZE, (ImWchar)-1);
+    }
+    return GetIndexOffset(c);
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -2502,6 +4246,7 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
     Glyphs.resize(Glyphs.Size + 1);
     ImFontGlyph& glyph = Glyphs.back();
     glyph.Codepoint = (ImWchar)codepoint;
+    glyph.DynamicSlot = 0;
     glyph.X0 = x0;
     glyph.Y0 = y0;
     glyph.X1 = x1;
@@ -2523,37 +4268,95 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    int index_size = IndexLookup.Size;
+    const int dst_offset = GetIndexOffset(dst);
+    const int src_offset = GetIndexOffset(src);
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst_offset >= 0 && IndexLookup.Data[dst_offset] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
-    if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
+    if (src_offset < 0 && dst_offset < 0) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const ImWchar src_lookup = (src_offset >= 0) ? IndexLookup.Data[src_offset] : (ImWchar)-1;
+    const float src_advance_x = (src_offset >= 0) ? IndexAdvanceX.Data[src_offset] : 1.0f;
+    const int new_dst_offset = AllocIndexOffset(dst);
+    IndexLookup[new_dst_offset] = src_lookup;
+    IndexAdvanceX[new_dst_offset] = src_advance_x;
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    const int index_offset = GetIndexOffset(c);
+    if (index_offset < 0)
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[index_offset];
     if (i == (ImWchar)-1)
         return FallbackGlyph;
-    return &Glyphs.Data[i];
+    const ImFontGlyph* glyph = &Glyphs.Data[i];
+    if (glyph->DynamicSlot != 0 && !ImFontAtlasDynamicUseGlyph(ContainerAtlas, (ImFont*)this, i))
+        return FallbackGlyph;
+    return glyph;
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    const int index_offset = GetIndexOffset(c);
+    if (index_offset < 0)
         return NULL;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[index_offset];
     if (i == (ImWchar)-1)
         return NULL;
-    return &Glyphs.Data[i];
+    const ImFontGlyph* glyph = &Glyphs.Data[i];
+    if (glyph->DynamicSlot != 0 && !ImFontAtlasDynamicUseGlyph(ContainerAtlas, (ImFont*)this, i))
+        return NULL;
+    return glyph;
+}
+
+// Classify 16 bytes of text at once for the ASCII fast paths of CalcWordWrapPositionA() and CalcTextSizeA().
+// Bit n of the returned mask is set when text[n] can be measured with a single IndexAdvanceX[] lookup, so callers can
+// consume the run of low set bits without UTF-8 decoding or special cases. Characters are still accumulated one at a time
+// in the same order as the scalar code, so results are identical. Without SSE2/NEON only the scalar code is used.
+#if defined(IMGUI_ENABLE_SSE2) || defined(IMGUI_ENABLE_NEON)
+#define IMGUI_ENABLE_TEXT_SIMD
+#if defined(IMGUI_ENABLE_SSE2)
+typedef __m128i ImTextVec16;
+static inline ImTextVec16  ImTextVec16Load(const char* p)                           { return _mm_loadu_si128((const __m128i*)(const void*)p); }
+static inline ImTextVec16  ImTextVec16IsPrintable(ImTextVec16 v)                    { return _mm_cmpgt_epi8(v, _mm_set1_epi8(0x1F)); } // Signed: 0x20..0x7F
+static inline ImTextVec16  ImTextVec16IsEqual(ImTextVec16 v, char c)                { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+static inline ImTextVec16  ImTextVec16Or(ImTextVec16 a, ImTextVec16 b)              { return _mm_or_si128(a, b); }
+static inline ImTextVec16  ImTextVec16AndNot(ImTextVec16 a, ImTextVec16 not_b)      { return _mm_andnot_si128(not_b, a); }
+static inline unsigned int ImTextVec16Mask(ImTextVec16 v)                           { return (unsigned int)_mm_movemask_epi8(v); }
+#else
+typedef int8x16_t ImTextVec16;
+static inline ImTextVec16  ImTextVec16Load(const char* p)                           { return vld1q_s8((const int8_t*)p); }
+static inline ImTextVec16  ImTextVec16IsPrintable(ImTextVec16 v)                    { return vreinterpretq_s8_u8(vcgtq_s8(v, vdupq_n_s8(0x1F))); } // Signed: 0x20..0x7F
+static inline ImTextVec16  ImTextVec16IsEqual(ImTextVec16 v, char c)                { return vreinterpretq_s8_u8(vceqq_s8(v, vdupq_n_s8((int8_t)c))); }
+static inline ImTextVec16  ImTextVec16Or(ImTextVec16 a, ImTextVec16 b)              { return vorrq_s8(a, b); }
+static inline ImTextVec16  ImTextVec16AndNot(ImTextVec16 a, ImTextVec16 not_b)      { return vbicq_s8(a, not_b); }
+static inline unsigned int ImTextVec16Mask(ImTextVec16 v)
+{
+    static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t masked = vandq_u8(vreinterpretq_u8_s8(v), vld1q_u8(bits));
+    return (unsigned int)vaddv_u8(vget_low_u8(masked)) | ((unsigned int)vaddv_u8(vget_high_u8(masked)) << 8);
+}
+#endif
+
+// Printable ASCII (0x20..0x7F): measured by CalcTextSizeA() with a single lookup.
+static inline unsigned int ImTextMaskPrintableAscii16(const char* text)
+{
+    return ImTextVec16Mask(ImTextVec16IsPrintable(ImTextVec16Load(text)));
+}
+
+// Printable ASCII which is neither a blank nor a punctuation where CalcWordWrapPositionA() allows wrapping.
+static inline unsigned int ImTextMaskWordAscii16(const char* text)
+{
+    const ImTextVec16 v = ImTextVec16Load(text);
+    ImTextVec16 separators = ImTextVec16Or(ImTextVec16IsEqual(v, ' '), ImTextVec16IsEqual(v, '.'));
+    separators = ImTextVec16Or(separators, ImTextVec16Or(ImTextVec16IsEqual(v, ','), ImTextVec16IsEqual(v, ';')));
+    separators = ImTextVec16Or(separators, ImTextVec16Or(ImTextVec16IsEqual(v, '!'), ImTextVec16IsEqual(v, '?')));
+    separators = ImTextVec16Or(separators, ImTextVec16IsEqual(v, '\"'));
+    return ImTextVec16Mask(ImTextVec16AndNot(ImTextVec16IsPrintable(v), separators));
 }
+#endif // #if defined(IMGUI_ENABLE_SSE2) || defined(IMGUI_ENABLE_NEON)
 
 const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
 {
@@ -2580,10 +4383,32 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     const char* word_end = text;
     const char* prev_word_end = NULL;
     bool inside_word = true;
+#ifdef IMGUI_ENABLE_TEXT_SIMD
+    const bool ascii_fast_path = (IndexAdvanceX.Size >= 0x80);
+#endif
 
     const char* s = text;
     while (s < text_end)
     {
+#ifdef IMGUI_ENABLE_TEXT_SIMD
+        // Fast path: continue the current word with up to 16 characters at a time. Same operations as the non-blank case below.
+        if (ascii_fast_path && inside_word && text_end - s >= 16)
+        {
+            unsigned int word_mask = ImTextMaskWordAscii16(s);
+            if (word_mask & 1)
+            {
+                for (; word_mask & 1; word_mask >>= 1, s++)
+                {
+                    word_width += IndexAdvanceX.Data[(unsigned char)*s];
+                    if (line_width + word_width >= wrap_width)
+                        return (word_width < wrap_width) ? (prev_word_end ? prev_word_end : s + 1) : s;
+                }
+                word_end = s;
+                continue;
+            }
+        }
+#endif
+
         unsigned int c = (unsigned int)*s;
         const char* next_s;
         if (c < 0x80)
@@ -2609,7 +4434,8 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const int index_offset = GetIndexOffset(c);
+        const float char_width = (index_offset >= 0) ? IndexAdvanceX.Data[index_offset] : FallbackAdvanceX;
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -2667,6 +4493,9 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+#ifdef IMGUI_ENABLE_TEXT_SIMD
+    const bool ascii_fast_path = (IndexAdvanceX.Size >= 0x80);
+#endif
 
     const char* s = text_begin;
     while (s < text_end)
@@ -2699,6 +4528,32 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+#ifdef IMGUI_ENABLE_TEXT_SIMD
+        // Fast path: up to 16 printable ASCII characters at a time, not crossing the wrapping point. Same operations as below.
+        if (ascii_fast_path && text_end - s >= 16)
+        {
+            unsigned int printable_mask = ImTextMaskPrintableAscii16(s);
+            if (printable_mask & 1)
+            {
+                const char* run_end = word_wrap_enabled ? word_wrap_eol : text_end;
+                bool max_width_reached = false;
+                for (; (printable_mask & 1) && s < run_end; printable_mask >>= 1, s++)
+                {
+                    const float char_width = IndexAdvanceX.Data[(unsigned char)*s] * scale;
+                    if (line_width + char_width >= max_width)
+                    {
+                        max_width_reached = true;
+                        break;
+                    }
+                    line_width += char_width;
+                }
+                if (max_width_reached)
+                    break;
+                continue;
+            }
+        }
+#endif
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -2726,7 +4581,8 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const int index_offset = GetIndexOffset(c);
+        const float char_width = ((index_offset >= 0) ? IndexAdvanceX.Data[index_offset] : FallbackAdvanceX) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -2951,6 +4807,161 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size;
 }
 
+// Decode text into glyphs for ImFontRenderLayout(), following the same rules as ImFont::RenderText() without word-wrapping.
+// Used by the text size cache (io.ConfigTextSizeCache). Return false on malformed UTF-8, which RenderText() stops at.
+bool ImFontLayoutText(const ImFont* font, const char* text_begin, const char* text_end, ImVector<ImFontLayoutGlyph>* out_glyphs)
+{
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+        {
+            s += 1;
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0) // Malformed UTF-8?
+                return false;
+        }
+
+        ImFontLayoutGlyph layout_glyph;
+        if (c == '\n')
+        {
+            layout_glyph.Glyph = NULL;
+            layout_glyph.Visible = false;
+        }
+        else if (c == '\r')
+        {
+            continue;
+        }
+        else
+        {
+            layout_glyph.Glyph = font->FindGlyph((ImWchar)c);
+            if (layout_glyph.Glyph == NULL)
+                continue;
+            layout_glyph.Visible = (c != ' ' && c != '\t');
+        }
+        out_glyphs->push_back(layout_glyph);
+    }
+    return true;
+}
+
+// Render glyphs laid out by ImFontLayoutText(). Output is identical to ImFont::RenderText() with the text they were laid out from and no word-wrapping.
+void ImFontRenderLayout(const ImFont* font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const ImFontLayoutGlyph* glyphs, int glyphs_count, bool cpu_fine_clip)
+{
+    // Align to be pixel perfect
+    pos.x = (float)(int)pos.x + font->DisplayOffset.x;
+    pos.y = (float)(int)pos.y + font->DisplayOffset.y;
+    float x = pos.x;
+    float y = pos.y;
+    if (y > clip_rect.w)
+        return;
+
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+
+    // Fast-forward to first visible line
+    const ImFontLayoutGlyph* layout_glyph = glyphs;
+    const ImFontLayoutGlyph* layout_glyph_end = glyphs + glyphs_count;
+    while (y + line_height < clip_rect.y && layout_glyph < layout_glyph_end)
+    {
+        while (layout_glyph < layout_glyph_end && (layout_glyph++)->Glyph != NULL) {}
+        y += line_height;
+    }
+    if (layout_glyph == layout_glyph_end)
+        return;
+
+    // Reserve vertices for remaining worse case
+    const int vtx_count_max = (int)(layout_glyph_end - layout_glyph) * 4;
+    const int idx_count_max = (int)(layout_glyph_end - layout_glyph) * 6;
+    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+
+    for (; layout_glyph < layout_glyph_end; layout_glyph++)
+    {
+        const ImFontGlyph* glyph = layout_glyph->Glyph;
+        if (glyph == NULL)
+        {
+            x = pos.x;
+            y += line_height;
+            if (y > clip_rect.w)
+                break;
+            continue;
+        }
+
+        const float char_width = glyph->AdvanceX * scale;
+        if (layout_glyph->Visible)
+        {
+            float x1 = x + glyph->X0 * scale;
+            float x2 = x + glyph->X1 * scale;
+            float y1 = y + glyph->Y0 * scale;
+            float y2 = y + glyph->Y1 * scale;
+            if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+            {
+                float u1 = glyph->U0;
+                float v1 = glyph->V0;
+                float u2 = glyph->U1;
+                float v2 = glyph->V1;
+
+                // CPU side clipping, same as ImFont::RenderText()
+                if (cpu_fine_clip)
+                {
+                    if (x1 < clip_rect.x)
+                    {
+                        u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1);
+                        x1 = clip_rect.x;
+                    }
+                    if (y1 < clip_rect.y)
+                    {
+                        v1 = v1 + (1.0f - (y2 - clip_rect.y) / (y2 - y1)) * (v2 - v1);
+                        y1 = clip_rect.y;
+                    }
+                    if (x2 > clip_rect.z)
+                    {
+                        u2 = u1 + ((clip_rect.z - x1) / (x2 - x1)) * (u2 - u1);
+                        x2 = clip_rect.z;
+                    }
+                    if (y2 > clip_rect.w)
+                    {
+                        v2 = v1 + ((clip_rect.w - y1) / (y2 - y1)) * (v2 - v1);
+                        y2 = clip_rect.w;
+                    }
+                    if (y1 >= y2)
+                    {
+                        x += char_width;
+                        continue;
+                    }
+                }
+
+                idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+                idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+                vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+                vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+                vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+                vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                vtx_write += 4;
+                vtx_current_idx += 4;
+                idx_write += 6;
+            }
+        }
+        x += char_width;
+    }
+
+    // Give back unused vertices
+    draw_list->VtxBuffer.resize((int)(vtx_write - draw_list->VtxBuffer.Data));
+    draw_list->IdxBuffer.resize((int)(idx_write - draw_list->IdxBuffer.Data));
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size-1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Internal Render Helpers
 // (progressively moved from imgui.cpp to here when they are redesigned to stop accessing ImGui global state)
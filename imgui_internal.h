@@ -35,6 +35,20 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#ifdef _MSC_VER
+#include <intrin.h>     // _InterlockedExchangeAdd
+#endif
+
+// Enable SSE2/NEON code paths (see IMGUI_DISABLE_SIMD in imconfig.h). NEON paths require AArch64 (vector division and square root).
+#ifndef IMGUI_DISABLE_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_ENABLE_SSE2
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+#endif
 
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -61,6 +75,8 @@ Index of this file:
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImFontAtlasDynamicStats;     // Counters for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontLayoutGlyph;           // Glyph decoded from a text, kept by the text size cache to render the text again (io.ConfigTextSizeCache)
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColumnData;             // Storage data for a single column
 struct ImGuiColumns;                // Storage data for a columns set
@@ -78,7 +94,10 @@ struct ImGuiSettingsHandler;        // Storage for one type registered in the .i
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
+struct ImGuiTextSizeCache;          // Storage for CalcTextSize() results and text glyphs reused across frames (io.ConfigTextSizeCache)
+struct ImGuiTextLineIndex;          // Offsets and maximum width of the lines of a large text, extended as text is appended (io.ConfigTextLineIndex)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowsSpatialIndex;    // Uniform grid listing the windows overlapping each cell of the display, used to find the hovered window (io.ConfigWindowsSpatialIndex)
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
 struct ImGuiWindowSettings;         // Storage for window settings stored in .ini file (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -165,6 +184,13 @@ static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c =
 static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 #define ImQsort         qsort
+#if defined(_MSC_VER)
+static inline int       ImAtomicAdd(int* p, int v)      { return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v); }   // Return previous value. For counters updated from worker threads.
+#elif defined(__GNUC__) || defined(__clang__)
+static inline int       ImAtomicAdd(int* p, int v)      { return __atomic_fetch_add(p, v, __ATOMIC_RELAXED); }
+#else
+static inline int       ImAtomicAdd(int* p, int v)      { int prev = *p; *p += v; return prev; }                                // Not atomic on other compilers
+#endif
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImU32     ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
@@ -271,7 +297,7 @@ struct ImBoolVector
     void            SetBit(int n, bool v)   { int off = (n >> 5); int mask = 1 << (n & 31); if (v) Storage[off] |= mask; else Storage[off] &= ~mask; }
 };
 
-// Helper: ImPool<>. Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
+// Helper: ImPool<>. Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer (O(1) with IMGUI_USE_HASHED_STORAGE),
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
 typedef int ImPoolIdx;
 template<typename T>
@@ -288,7 +314,7 @@ struct IMGUI_API ImPool
     ImPoolIdx   GetIndex(const T* p) const          { IM_ASSERT(p >= Data.Data && p < Data.Data + Data.Size); return (ImPoolIdx)(p - Data.Data); }
     T*          GetOrAddByKey(ImGuiID key)          { int* p_idx = Map.GetIntRef(key, -1); if (*p_idx != -1) return &Data[*p_idx]; *p_idx = FreeIdx; return Add(); }
     bool        Contains(const T* p) const          { return (p >= Data.Data && p < Data.Data + Data.Size); }
-    void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { int idx = Map.Data[n].val_i; if (idx != -1) Data[idx].~T(); } Map.Clear(); Data.clear(); FreeIdx = 0; }
+    void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { if (!Map.IsPairUsed(n)) continue; int idx = Map.Data[n].val_i; if (idx != -1) Data[idx].~T(); } Map.Clear(); Data.clear(); FreeIdx = 0; }
     T*          Add()                               { int idx = FreeIdx; if (idx == Data.Size) { Data.resize(Data.Size + 1); FreeIdx++; } else { FreeIdx = *(int*)&Data[idx]; } IM_PLACEMENT_NEW(&Data[idx]) T(); return &Data[idx]; }
     void        Remove(ImGuiID key, const T* p)     { Remove(key, GetIndex(p)); }
     void        Remove(ImGuiID key, ImPoolIdx idx)  { Data[idx].~T(); *(int*)&Data[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); }
@@ -710,19 +736,47 @@ struct ImGuiColumns
 };
 
 // Data shared between all ImDrawList instances
+// ImDrawList: number of segments for AddCircle()/AddCircleFilled() when none is specified. The error is the distance between
+// the circle and the middle of a segment: radius * (1 - cos(PI / num_segments)). Rounded up to an even number.
+#define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN                 4
+#define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX                 512
+#define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(_RAD,_MAXERROR) ImClamp((((int)ImCeil(IM_PI / ImAcos(1.0f - ImMin((_MAXERROR), (_RAD)) / (_RAD))) + 1) / 2) * 2, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX)
+
+// ImDrawList: unit circle vertices are precomputed for segment counts up to this value (larger circles use a fixed-angle rotation)
+#define IM_DRAWLIST_CIRCLE_VTX_TABLE_MAX_SEGMENTS           64
+
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas
     ImFont*         Font;                       // Current/default font (optional, for simplified AddText overload)
     float           FontSize;                   // Current/default font size (optional, for simplified AddText overload)
     float           CurveTessellationTol;
+    float           CircleSegmentMaxError;      // Copy of style.CircleSegmentMaxError, use SetCircleSegmentMaxError() to modify
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
 
     // Const data
     // FIXME: Bake rounded corners fill/borders in atlas
     ImVec2          CircleVtx12[12];
+    ImU16           CircleSegmentCounts[64];    // Segment count for radius (array index + 1), from CircleSegmentMaxError
+    ImVector<ImVec2> CircleVtxTables;           // Unit circle vertices for 3..IM_DRAWLIST_CIRCLE_VTX_TABLE_MAX_SEGMENTS segments, at the same angles as AddCircle()
+    int             CircleVtxTableOffsets[IM_DRAWLIST_CIRCLE_VTX_TABLE_MAX_SEGMENTS + 1];
 
     ImDrawListSharedData();
+    void            SetCircleSegmentMaxError(float max_error);
+    int             CalcCircleSegmentCount(float radius) const;
+    const ImVec2*   GetCircleVtxTable(int num_segments) const   { return (num_segments >= 3 && num_segments <= IM_DRAWLIST_CIRCLE_VTX_TABLE_MAX_SEGMENTS) ? CircleVtxTables.Data + CircleVtxTableOffsets[num_segments] : NULL; }
+};
+
+// Counters for glyphs rasterized on demand, see ImFontAtlasGetDynamicStats()
+struct ImFontAtlasDynamicStats
+{
+    int     GlyphsResident;         // Glyphs currently rasterized on demand into the texture
+    int     GlyphsRasterized;       // Total glyphs rasterized on demand since Build(), including glyphs rasterized again after being evicted
+    int     GlyphsEvicted;          // Total glyphs evicted to make space
+    int     GlyphsDropped;          // Glyphs which didn't fit in the texture after repacking, displayed with the fallback glyph until the next Build()
+    int     Compactions;            // Number of times the texture was full and resident glyphs were repacked
+
+    ImFontAtlasDynamicStats()       { memset(this, 0, sizeof(*this)); }
 };
 
 struct ImDrawDataBuilder
@@ -800,6 +854,109 @@ struct ImGuiNextItemData
     inline void ClearFlags()    { Flags = ImGuiNextItemDataFlags_None; }
 };
 
+//-----------------------------------------------------------------------------
+// Text size cache
+//-----------------------------------------------------------------------------
+
+// Used by CalcTextSize() and RenderText*() when io.ConfigTextSizeCache is set, for wrapped texts and texts of at least IMGUI_TEXT_SIZE_CACHE_MIN_LEN bytes.
+// Entries store a copy of the text along with font, font atlas build, font size and wrap width, which are all compared on lookup:
+// a hash collision never returns the size of another string. The 64-bit hash is only computed when the text address differs
+// from the last lookup of that entry (e.g. labels passed as literals skip it, formatted text in g.TempBuffer doesn't).
+// Unwrapped texts up to IMGUI_TEXT_SIZE_CACHE_LAYOUT_MAX_LEN bytes also keep their decoded glyphs, so rendering them doesn't decode UTF-8 or look glyphs up again.
+// Glyphs are not kept for atlases with ImFontAtlasFlags_DynamicGlyphs, whose glyphs are evicted and moved on demand.
+#define IMGUI_TEXT_SIZE_CACHE_EVICT_FRAMES      60      // Entries not used during that many frames are evicted (checked every that many frames)
+#define IMGUI_TEXT_SIZE_CACHE_MIN_LEN          32      // Shorter unwrapped texts are measured and rendered directly: a lookup costs about as much
+#define IMGUI_TEXT_SIZE_CACHE_LAYOUT_MAX_LEN    512     // Longest text (in bytes) whose glyphs are kept
+#define IMGUI_TEXT_SIZE_CACHE_ADDR_SLOTS        256     // Entries of the last lookups, indexed by text address
+
+// Glyph laid out by ImFontLayoutText(). A NULL Glyph is a line break.
+struct ImFontLayoutGlyph
+{
+    const ImFontGlyph*  Glyph;
+    bool                Visible;            // false for ' ' and '\t', which only advance
+};
+
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64       Hash;                       // Hash of the text and of the fields below, indexes the entry in ImGuiTextSizeCache::Buckets
+    const char* TextAddr;                   // Address of the text during the last lookup. Only used to skip hashing, the contents are always compared.
+    int         TextOffset;                 // Copy of the text in ImGuiTextSizeCache::TextBuf
+    int         TextLen;
+    const ImFont* Font;
+    int         FontBuildCount;
+    float       FontSize;
+    float       WrapWidth;                  // <= 0.0f values are stored as 0.0f
+    int         LastFrameUsed;
+    ImVec2      Size;
+    int         GlyphsOffset;               // Glyphs in ImGuiTextSizeCache::Glyphs, -1 if not laid out yet, -2 if they can't be (wrapped, too long, malformed UTF-8, dynamic glyphs)
+    int         GlyphsCount;
+};
+
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;
+    ImVector<int>               Buckets;                        // Open addressing (linear probing) on Hash, index in Entries or -1. Size is a power of two.
+    int                         AddrSlots[IMGUI_TEXT_SIZE_CACHE_ADDR_SLOTS];  // Index in Entries or -1
+    ImVector<char>              TextBuf;
+    ImVector<ImFontLayoutGlyph> Glyphs;
+    int             Hits, Misses, GlyphsHits;                   // Current frame
+    int             HitsLastFrame, MissesLastFrame, GlyphsHitsLastFrame; // Previous frame, displayed in Metrics
+    int             EvictedTotal;
+
+    ImGuiTextSizeCache()    { Hits = Misses = GlyphsHits = HitsLastFrame = MissesLastFrame = GlyphsHitsLastFrame = EvictedTotal = 0; Clear(); }
+    void Clear()            { Entries.clear(); Buckets.clear(); TextBuf.clear(); Glyphs.clear(); for (int n = 0; n < IMGUI_TEXT_SIZE_CACHE_ADDR_SLOTS; n++) AddrSlots[n] = -1; }
+};
+
+//-----------------------------------------------------------------------------
+// Text line index
+//-----------------------------------------------------------------------------
+
+// Used by TextEx() for unwrapped texts larger than 2000 bytes when io.ConfigTextLineIndex is set: jump to the first visible line
+// and get the size of the text without scanning the other lines. Only the bytes appended since the previous frame are scanned.
+#define IMGUI_TEXT_LINE_INDEX_CHECK_SIZE    64      // Bytes hashed at the beginning of the text and before the last indexed line, to detect a text replaced by another
+#define IMGUI_TEXT_LINE_INDEX_EVICT_FRAMES  600     // Indices not used during that many frames are released
+
+struct ImGuiTextLineIndex
+{
+    const char*     Text;               // Address of the text when last used
+    ImFont*         Font;               // Font used to measure lines, with FontSize and FontBuildCount
+    float           FontSize;
+    int             FontBuildCount;
+    bool            MeasureWidths;      // false with ImGuiTextFlags_NoWidthForLargeClippedText: MaxWidth isn't measured
+    ImVector<int>   LineOffsets;        // Offset of the beginning of each line, the last one is the beginning of the unterminated line (== IndexedEnd)
+    int             IndexedEnd;         // Offset after the last '\n' indexed
+    float           MaxWidth;           // Width of the widest terminated line
+    ImU32           HeadHash, TailHash; // Hashes of IMGUI_TEXT_LINE_INDEX_CHECK_SIZE bytes at the beginning of the text and before IndexedEnd
+    int             LastFrameUsed;
+
+    ImGuiTextLineIndex()    { Text = NULL; Font = NULL; FontSize = 0.0f; FontBuildCount = 0; MeasureWidths = false; HeadHash = 0; LastFrameUsed = 0; Clear(); }
+    void Clear()            { LineOffsets.resize(0); IndexedEnd = 0; MaxWidth = 0.0f; TailHash = 0; }
+    int  GetLinesCount(int text_len) const { return (LineOffsets.back() < text_len) ? LineOffsets.Size : LineOffsets.Size - 1; } // Last line isn't counted if empty, same as scanning with memchr()
+};
+
+//-----------------------------------------------------------------------------
+// Windows spatial index
+//-----------------------------------------------------------------------------
+
+// Used by FindHoveredWindow() when io.ConfigWindowsSpatialIndex is set: only the windows listed in the cell under the mouse are tested.
+// Each window is listed in every cell overlapped by its OuterRectClipped expanded by HitPadding, and moved between cells in Begin() when
+// this range of cells changes. Windows outside of the display are listed in the border cells. Rebuilt when the display size or the
+// padding change.
+#define IMGUI_WINDOWS_SPATIAL_INDEX_CELL_SIZE   128.0f
+
+struct ImGuiWindowsSpatialIndex
+{
+    int                     CellsX, CellsY;     // 0 when not built
+    ImVec2                  HitPadding;         // Largest padding added to OuterRectClipped by FindHoveredWindow()
+    ImVector<ImVector<ImGuiWindow*> > Cells;    // CellsX * CellsY lists of windows, unordered
+
+    ImGuiWindowsSpatialIndex()  { CellsX = CellsY = 0; }
+    ~ImGuiWindowsSpatialIndex() { Clear(); }
+    void Clear()                { for (int n = 0; n < Cells.Size; n++) Cells[n].clear(); Cells.clear(); CellsX = CellsY = 0; HitPadding = ImVec2(0.0f, 0.0f); }
+    int  GetCellX(float x) const { return (int)ImClamp(x * (1.0f / IMGUI_WINDOWS_SPATIAL_INDEX_CELL_SIZE), 0.0f, (float)(CellsX - 1)); } // Clamped before the conversion to int, coordinates can be +/-FLT_MAX
+    int  GetCellY(float y) const { return (int)ImClamp(y * (1.0f / IMGUI_WINDOWS_SPATIAL_INDEX_CELL_SIZE), 0.0f, (float)(CellsY - 1)); }
+};
+
 //-----------------------------------------------------------------------------
 // Tabs
 //-----------------------------------------------------------------------------
@@ -1018,6 +1175,9 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture via CaptureKeyboardFromApp()/CaptureMouseFromApp() sets those flags
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
+    ImGuiTextSizeCache      TextSizeCache;                      // CalcTextSize() results when io.ConfigTextSizeCache is set
+    ImVector<ImGuiTextLineIndex*> TextLineIndices;              // Line indices of large texts when io.ConfigTextLineIndex is set
+    ImGuiWindowsSpatialIndex WindowsSpatialIndex;               // Windows overlapping each cell of the display when io.ConfigWindowsSpatialIndex is set
     char                    TempBuffer[1024*3+1];               // Temporary text buffer
 
     ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(NULL), ForegroundDrawList(NULL)
@@ -1284,6 +1444,8 @@ struct IMGUI_API ImGuiWindow
     ImVector<ImGuiID>       IDStack;                            // ID stack. ID are hashes seeded with the value at the top of the stack
     ImRect                  ClipRect;                           // Current clipping rectangle. = DrawList->clip_rect_stack.back(). Scissoring / clipping rectangle. x1, y1, x2, y2.
     ImRect                  OuterRectClipped;                   // = WindowRect just after setup in Begin(). == window->Rect() for root window.
+    ImRect                  SpatialIndexRect;                   // OuterRectClipped expanded by the hit padding, as registered in g.WindowsSpatialIndex (inverted when not registered)
+    int                     DisplayOrder;                       // Index in g.Windows, set when sorting windows in EndFrame(). May be stale, check g.Windows[DisplayOrder] == window.
     ImRect                  InnerMainRect, InnerClipRect;
     ImRect                  ContentsRegionRect;                 // FIXME: This is currently confusing/misleading. Maximum visible content position ~~ Pos + (SizeContentsExplicit ? SizeContentsExplicit : Size - ScrollbarSizes) - CursorStartPos, per axis
     int                     LastFrameActive;                    // Last frame number the window was Active.
@@ -1481,6 +1643,7 @@ namespace ImGui
     IMGUI_API void          FocusableItemUnregister(ImGuiWindow* window);
     IMGUI_API ImVec2        CalcItemSize(ImVec2 size, float default_w, float default_h);
     IMGUI_API float         CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x);
+    IMGUI_API ImGuiTextLineIndex* GetTextLineIndex(const char* text, const char* text_end, bool measure_widths);  // io.ConfigTextLineIndex
     IMGUI_API void          PushMultiItemsWidths(int components, float width_full);
     IMGUI_API void          PushItemFlag(ImGuiItemFlags option, bool enabled);
     IMGUI_API void          PopItemFlag();
@@ -1624,12 +1787,20 @@ namespace ImGui
 
 // ImFontAtlas internals
 IMGUI_API bool              ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasBuildIncrementalWithStbTruetype(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
-IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque, int rects_begin = 0);
 IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void              ImFontAtlasBuildMarkTexDirty(ImFontAtlas* atlas, int x, int y, int w, int h);
+IMGUI_API void              ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasGetDynamicStats(const ImFontAtlas* atlas, ImFontAtlasDynamicStats* out_stats);
+
+// ImFont internals
+IMGUI_API bool              ImFontLayoutText(const ImFont* font, const char* text_begin, const char* text_end, ImVector<ImFontLayoutGlyph>* out_glyphs);
+IMGUI_API void              ImFontRenderLayout(const ImFont* font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const ImFontLayoutGlyph* glyphs, int glyphs_count, bool cpu_fine_clip);
 
 // Test engine hooks (imgui-test)
 //#define IMGUI_ENABLE_TEST_ENGINE
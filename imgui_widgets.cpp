@@ -153,9 +153,39 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
         const float line_height = GetTextLineHeight();
         ImVec2 text_size(0,0);
 
-        // Lines to skip (can't skip when logging text)
+        // With io.ConfigTextLineIndex, jump to the first visible line and get the size from the index
         ImVec2 pos = text_pos;
-        if (!g.LogEnabled)
+        if (g.IO.ConfigTextLineIndex && !g.LogEnabled)
+        {
+            const bool measure_widths = (flags & ImGuiTextFlags_NoWidthForLargeClippedText) == 0;
+            const ImGuiTextLineIndex* index = GetTextLineIndex(text, text_end, measure_widths);
+            const int lines_count = index->GetLinesCount((int)(text_end - text));
+            const int line_first = ImClamp((int)((window->ClipRect.Min.y - text_pos.y) / line_height), 0, lines_count);
+            text_size.x = index->MaxWidth;
+            if (measure_widths && index->IndexedEnd < (int)(text_end - text))
+                text_size.x = ImMax(text_size.x, CalcTextSize(text + index->IndexedEnd, text_end).x);
+            pos.y += line_first * line_height;
+            ImRect line_rect(pos, pos + ImVec2(FLT_MAX, line_height));
+            int line_n = line_first;
+            for (; line_n < lines_count; line_n++)
+            {
+                if (IsClippedEx(line_rect, 0, false))
+                    break;
+                line = text + index->LineOffsets[line_n];
+                const char* line_end = (line_n + 1 < index->LineOffsets.Size) ? text + index->LineOffsets[line_n + 1] - 1 : text_end;
+                if (!measure_widths)
+                    text_size.x = ImMax(text_size.x, CalcTextSize(line, line_end).x);
+                RenderText(pos, line, line_end, false);
+                line_rect.Min.y += line_height;
+                line_rect.Max.y += line_height;
+                pos.y += line_height;
+            }
+            pos.y += (lines_count - line_n) * line_height; // Same steps as below, so the height is the same as without the index
+            line = text_end;
+        }
+
+        // Lines to skip (can't skip when logging text)
+        else if (!g.LogEnabled)
         {
             int lines_skippable = (int)((window->ClipRect.Min.y - text_pos.y) / line_height);
             if (lines_skippable > 0)
@@ -3455,9 +3485,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         password_font->Ascent = g.Font->Ascent;
         password_font->Descent = g.Font->Descent;
         password_font->ContainerAtlas = g.Font->ContainerAtlas;
+        password_font->Sdf = g.Font->Sdf;
         password_font->FallbackGlyph = glyph;
         password_font->FallbackAdvanceX = glyph->AdvanceX;
-        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
+        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty() && password_font->IndexPages.empty());
         PushFont(password_font);
     }
 